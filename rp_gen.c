@@ -1,154 +1,3588 @@
 #include "rp_gen.h"
 #include <math.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#if !defined(RP_NO_THREADS) && (!defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__))
+#include <pthread.h>
+#include <unistd.h>
+#define RP_HAS_THREADS 1
+#endif
 
 #define RP_PI32 3.14159265359f
 
-void rp_gen(struct rp_data *data)
+#if !defined(RP_NO_SIMD)
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RP_HAS_SSE2 1
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && defined(RP_HAS_SSE2)
+#include <immintrin.h>
+#define RP_HAS_AVX2 1
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RP_HAS_NEON 1
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define RP_HAS_WASM_SIMD128 1
+#endif
+#endif
+
+// ring order inside the vertex block: front facet, front edge, back facet, back edge
+#define RP_RING_COUNT 4
+
+static const float default_ring_colors[RP_RING_COUNT][3] = {
+	{ 1.0f, 0.0f, 0.0f }, // front face
+	{ 0.0f, 1.0f, 0.0f }, // edge
+	{ 0.0f, 0.0f, 1.0f }, // back face
+	{ 0.0f, 1.0f, 0.0f }  // edge
+};
+
+struct ring_params {
+	float *vertices;
+	int32_t facet_count;
+	float facet_rad;
+	float facet_radius;
+	float ring_z[RP_RING_COUNT];
+	const float (*ring_colors)[3];
+	// unit circle of facets [begin, end) of the kernel call, padded by RP_UNIT_PADDING for full vector loads;
+	// NULL evaluates sin/cos inline
+	const float *unit_sin;
+	const float *unit_cos;
+};
+
+// writes the four ring vertices of every facet in [begin, end)
+typedef void (*ring_kernel)(const struct ring_params *params, int32_t begin, int32_t end);
+
+// writes the circle position of every facet in [begin, end), scaled by scale, to s[0..end-begin) and
+// c[0..end-begin). with scale = facet_radius these are the exact x/y values the matching ring kernel stores.
+typedef void (*sincos_kernel)(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c);
+
+struct kernel_fns {
+	ring_kernel ring;
+	sincos_kernel sincos;
+};
+
+static inline void set_vertex(float *vertex, float x, float y, float z, const float *color)
 {
-	float *vertices = data->vertices;
-	uint16_t *indices = data->indices;
-	const int32_t facet_count = data->facet_count;
-	const float facet_radius = data->facet_radius;
-	const float extrusion_depth = data->extrusion_depth;
+	vertex[0] = x;
+	vertex[1] = y;
+	vertex[2] = z;
+	vertex[3] = color[0];
+	vertex[4] = color[1];
+	vertex[5] = color[2];
+	vertex[6] = 1.0f;
+}
 
-	assert(vertices && indices);
-	assert(facet_count >= 3);
-	assert(facet_radius > 0.0f);
-	assert(extrusion_depth > 0.0f);
+static inline void set_ring_vertices(const struct ring_params *params, int32_t facet_idx, float x, float y)
+{
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		float *vertex = &params->vertices[(ring * params->facet_count + facet_idx) * RP_VERTEX_STRIDE];
+		set_vertex(vertex, x, y, params->ring_z[ring], params->ring_colors[ring]);
+	}
+}
+
+// the reference kernel: libm sinf/cosf, one facet at a time
+static void ring_kernel_scalar(const struct ring_params *params, int32_t begin, int32_t end)
+{
+	for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+		float rad = params->facet_rad * facet_idx;
+		const float s = params->unit_sin ? params->unit_sin[facet_idx - begin] : sinf(rad);
+		const float c = params->unit_cos ? params->unit_cos[facet_idx - begin] : cosf(rad);
+		set_ring_vertices(params, facet_idx, s * params->facet_radius, c * params->facet_radius);
+	}
+}
+
+static void sincos_kernel_scalar(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c)
+{
+	for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+		float rad = facet_rad * facet_idx;
+		s[facet_idx - begin] = sinf(rad) * scale;
+		c[facet_idx - begin] = cosf(rad) * scale;
+	}
+}
+
+// the vector kernels share one sincos scheme: the angle (always >= 0 here) is reduced by k * pi/2 using a three
+// part cody-waite split, sin and cos are evaluated on [-pi/4, pi/4] with the cephes minimax polynomials, and the
+// quadrant k selects/negates the results. cos adds the 1 last, after the small terms (as cephes does), which keeps
+// every unit value within half an ulp of 1 of libm, so positions stay below 1 ulp of facet_radius of the reference.
+#define RP_SINCOS_2_OVER_PI 0.63661977236758134f
+#define RP_SINCOS_PIO2_1 1.5703125f
+#define RP_SINCOS_PIO2_2 4.837512969970703125e-4f
+#define RP_SINCOS_PIO2_3 7.54978995489188216e-8f
+#define RP_SINCOS_S1 -1.6666654611e-1f
+#define RP_SINCOS_S2 8.3321608736e-3f
+#define RP_SINCOS_S3 -1.9515295891e-4f
+#define RP_SINCOS_C1 4.166664568298827e-2f
+#define RP_SINCOS_C2 -1.388731625493765e-3f
+#define RP_SINCOS_C3 2.443315711809948e-5f
+
+#if defined(RP_HAS_SSE2)
+static inline void sincos_sse2(__m128 rad, __m128 *out_sin, __m128 *out_cos)
+{
+	const __m128i k = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(rad, _mm_set1_ps(RP_SINCOS_2_OVER_PI)),
+		_mm_set1_ps(0.5f)));
+	const __m128 kf = _mm_cvtepi32_ps(k);
+	__m128 r = _mm_sub_ps(rad, _mm_mul_ps(kf, _mm_set1_ps(RP_SINCOS_PIO2_1)));
+	r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(RP_SINCOS_PIO2_2)));
+	r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(RP_SINCOS_PIO2_3)));
+	const __m128 r2 = _mm_mul_ps(r, r);
+
+	__m128 sin_r = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(RP_SINCOS_S3)), _mm_set1_ps(RP_SINCOS_S2));
+	sin_r = _mm_add_ps(_mm_mul_ps(r2, sin_r), _mm_set1_ps(RP_SINCOS_S1));
+	sin_r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(r2, r), sin_r), r);
+
+	__m128 cos_r = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(RP_SINCOS_C3)), _mm_set1_ps(RP_SINCOS_C2));
+	cos_r = _mm_add_ps(_mm_mul_ps(r2, cos_r), _mm_set1_ps(RP_SINCOS_C1));
+	cos_r = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(r2, r2), cos_r), _mm_mul_ps(r2, _mm_set1_ps(0.5f)));
+	cos_r = _mm_add_ps(cos_r, _mm_set1_ps(1.0f));
+
+	const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	const __m128 s = _mm_or_ps(_mm_and_ps(swap, cos_r), _mm_andnot_ps(swap, sin_r));
+	const __m128 c = _mm_or_ps(_mm_and_ps(swap, sin_r), _mm_andnot_ps(swap, cos_r));
+	const __m128i sin_sign = _mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30);
+	const __m128i cos_sign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(k, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+	*out_sin = _mm_xor_ps(s, _mm_castsi128_ps(sin_sign));
+	*out_cos = _mm_xor_ps(c, _mm_castsi128_ps(cos_sign));
+}
+
+struct ring_consts_sse2 {
+	__m128 zrgb;
+	__m128 rgba;
+	__m128 ba;
+};
+
+static inline void load_ring_consts_sse2(const struct ring_params *params, struct ring_consts_sse2 *consts)
+{
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		const float *color = params->ring_colors[ring];
+		consts[ring].zrgb = _mm_setr_ps(params->ring_z[ring], color[0], color[1], color[2]);
+		consts[ring].rgba = _mm_setr_ps(color[0], color[1], color[2], 1.0f);
+		consts[ring].ba = _mm_setr_ps(color[2], 1.0f, 0.0f, 0.0f);
+	}
+}
+
+// interleaves four facets worth of x/y with the ring's constant z and color into 7 consecutive 16 byte stores
+static inline void store_ring_sse2(float *vertex, __m128 x, __m128 y, const struct ring_consts_sse2 *consts)
+{
+	const __m128 xy_lo = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+	const __m128 xy_hi = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+	const __m128 zrgb = consts->zrgb;
+	const __m128 rgba = consts->rgba;
+
+	const __m128 a_x1 = _mm_shuffle_ps(rgba, xy_lo, _MM_SHUFFLE(2, 2, 3, 3));
+	const __m128 y1_z = _mm_shuffle_ps(xy_lo, zrgb, _MM_SHUFFLE(0, 0, 3, 3));
+	const __m128 a_x3 = _mm_shuffle_ps(rgba, xy_hi, _MM_SHUFFLE(2, 2, 3, 3));
+	const __m128 y3_z = _mm_shuffle_ps(xy_hi, zrgb, _MM_SHUFFLE(0, 0, 3, 3));
+
+	_mm_storeu_ps(vertex + 0, _mm_movelh_ps(xy_lo, zrgb));                          // x0 y0 z  r
+	_mm_storeu_ps(vertex + 4, _mm_shuffle_ps(rgba, a_x1, _MM_SHUFFLE(2, 0, 2, 1))); // g  b  a  x1
+	_mm_storeu_ps(vertex + 8, _mm_shuffle_ps(y1_z, rgba, _MM_SHUFFLE(1, 0, 2, 0))); // y1 z  r  g
+	_mm_storeu_ps(vertex + 12, _mm_movelh_ps(consts->ba, xy_hi));                   // b  a  x2 y2
+	_mm_storeu_ps(vertex + 16, zrgb);                                               // z  r  g  b
+	_mm_storeu_ps(vertex + 20, _mm_shuffle_ps(a_x3, y3_z, _MM_SHUFFLE(2, 0, 2, 0))); // a  x3 y3 z
+	_mm_storeu_ps(vertex + 24, rgba);                                               // r  g  b  a
+}
+
+static void ring_kernel_sse2(const struct ring_params *params, int32_t begin, int32_t end)
+{
+	struct ring_consts_sse2 consts[RP_RING_COUNT];
+	load_ring_consts_sse2(params, consts);
+	const __m128 facet_rad = _mm_set1_ps(params->facet_rad);
+	const __m128 facet_radius = _mm_set1_ps(params->facet_radius);
+	const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+
+	int32_t facet_idx = begin;
+	for (; facet_idx < end; facet_idx += 4) {
+		const __m128 rad = _mm_mul_ps(facet_rad, _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(facet_idx), lanes)));
+		__m128 s, c;
+		if (params->unit_sin) {
+			s = _mm_loadu_ps(&params->unit_sin[facet_idx - begin]);
+			c = _mm_loadu_ps(&params->unit_cos[facet_idx - begin]);
+		} else {
+			sincos_sse2(rad, &s, &c);
+		}
+		const __m128 x = _mm_mul_ps(s, facet_radius);
+		const __m128 y = _mm_mul_ps(c, facet_radius);
+
+		if (end - facet_idx < 4) {
+			float xs[4], ys[4];
+			_mm_storeu_ps(xs, x);
+			_mm_storeu_ps(ys, y);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				set_ring_vertices(params, facet_idx + lane, xs[lane], ys[lane]);
+			}
+			break;
+		}
+
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			float *vertex = &params->vertices[(ring * params->facet_count + facet_idx) * RP_VERTEX_STRIDE];
+			store_ring_sse2(vertex, x, y, &consts[ring]);
+		}
+	}
+}
+
+static void sincos_kernel_sse2(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c)
+{
+	const __m128 rad_step = _mm_set1_ps(facet_rad);
+	const __m128 vscale = _mm_set1_ps(scale);
+	const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+	for (int32_t facet_idx = begin; facet_idx < end; facet_idx += 4) {
+		const __m128 rad = _mm_mul_ps(rad_step, _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(facet_idx), lanes)));
+		__m128 vs, vc;
+		sincos_sse2(rad, &vs, &vc);
+		vs = _mm_mul_ps(vs, vscale);
+		vc = _mm_mul_ps(vc, vscale);
+		if (end - facet_idx < 4) {
+			float ss[4], cs[4];
+			_mm_storeu_ps(ss, vs);
+			_mm_storeu_ps(cs, vc);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				s[facet_idx - begin + lane] = ss[lane];
+				c[facet_idx - begin + lane] = cs[lane];
+			}
+			break;
+		}
+		_mm_storeu_ps(&s[facet_idx - begin], vs);
+		_mm_storeu_ps(&c[facet_idx - begin], vc);
+	}
+}
+#endif
+
+#if defined(RP_HAS_AVX2)
+#define RP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+RP_TARGET_AVX2 static inline void sincos_avx2(__m256 rad, __m256 *out_sin, __m256 *out_cos)
+{
+	const __m256i k = _mm256_cvttps_epi32(_mm256_fmadd_ps(rad, _mm256_set1_ps(RP_SINCOS_2_OVER_PI),
+		_mm256_set1_ps(0.5f)));
+	const __m256 kf = _mm256_cvtepi32_ps(k);
+	__m256 r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(RP_SINCOS_PIO2_1), rad);
+	r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(RP_SINCOS_PIO2_2), r);
+	r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(RP_SINCOS_PIO2_3), r);
+	const __m256 r2 = _mm256_mul_ps(r, r);
+
+	__m256 sin_r = _mm256_fmadd_ps(r2, _mm256_set1_ps(RP_SINCOS_S3), _mm256_set1_ps(RP_SINCOS_S2));
+	sin_r = _mm256_fmadd_ps(r2, sin_r, _mm256_set1_ps(RP_SINCOS_S1));
+	sin_r = _mm256_fmadd_ps(_mm256_mul_ps(r2, r), sin_r, r);
+
+	__m256 cos_r = _mm256_fmadd_ps(r2, _mm256_set1_ps(RP_SINCOS_C3), _mm256_set1_ps(RP_SINCOS_C2));
+	cos_r = _mm256_fmadd_ps(r2, cos_r, _mm256_set1_ps(RP_SINCOS_C1));
+	cos_r = _mm256_fmadd_ps(_mm256_mul_ps(r2, r2), cos_r, _mm256_mul_ps(r2, _mm256_set1_ps(-0.5f)));
+	cos_r = _mm256_add_ps(cos_r, _mm256_set1_ps(1.0f));
+
+	const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(k, _mm256_set1_epi32(1)),
+		_mm256_set1_epi32(1)));
+	const __m256 s = _mm256_blendv_ps(sin_r, cos_r, swap);
+	const __m256 c = _mm256_blendv_ps(cos_r, sin_r, swap);
+	const __m256i sin_sign = _mm256_slli_epi32(_mm256_and_si256(k, _mm256_set1_epi32(2)), 30);
+	const __m256i cos_sign = _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(k, _mm256_set1_epi32(1)),
+		_mm256_set1_epi32(2)), 30);
+	*out_sin = _mm256_xor_ps(s, _mm256_castsi256_ps(sin_sign));
+	*out_cos = _mm256_xor_ps(c, _mm256_castsi256_ps(cos_sign));
+}
+
+// eight facets per iteration; the interleaving reuses the 16 byte store pattern since the 7 float vertex stride
+// never lines up with 32 byte lanes
+RP_TARGET_AVX2 static void ring_kernel_avx2(const struct ring_params *params, int32_t begin, int32_t end)
+{
+	struct ring_consts_sse2 consts[RP_RING_COUNT];
+	load_ring_consts_sse2(params, consts);
+	const __m256 facet_rad = _mm256_set1_ps(params->facet_rad);
+	const __m256 facet_radius = _mm256_set1_ps(params->facet_radius);
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+	int32_t facet_idx = begin;
+	for (; facet_idx < end; facet_idx += 8) {
+		const __m256i idx = _mm256_add_epi32(_mm256_set1_epi32(facet_idx), lanes);
+		const __m256 rad = _mm256_mul_ps(facet_rad, _mm256_cvtepi32_ps(idx));
+		__m256 s, c;
+		if (params->unit_sin) {
+			s = _mm256_loadu_ps(&params->unit_sin[facet_idx - begin]);
+			c = _mm256_loadu_ps(&params->unit_cos[facet_idx - begin]);
+		} else {
+			sincos_avx2(rad, &s, &c);
+		}
+		const __m256 x = _mm256_mul_ps(s, facet_radius);
+		const __m256 y = _mm256_mul_ps(c, facet_radius);
+
+		if (end - facet_idx < 8) {
+			float xs[8], ys[8];
+			_mm256_storeu_ps(xs, x);
+			_mm256_storeu_ps(ys, y);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				set_ring_vertices(params, facet_idx + lane, xs[lane], ys[lane]);
+			}
+			break;
+		}
+
+		const __m128 x_lo = _mm256_castps256_ps128(x);
+		const __m128 y_lo = _mm256_castps256_ps128(y);
+		const __m128 x_hi = _mm256_extractf128_ps(x, 1);
+		const __m128 y_hi = _mm256_extractf128_ps(y, 1);
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			float *vertex = &params->vertices[(ring * params->facet_count + facet_idx) * RP_VERTEX_STRIDE];
+			store_ring_sse2(vertex, x_lo, y_lo, &consts[ring]);
+			store_ring_sse2(vertex + 4 * RP_VERTEX_STRIDE, x_hi, y_hi, &consts[ring]);
+		}
+	}
+}
+
+RP_TARGET_AVX2 static void sincos_kernel_avx2(float facet_rad, int32_t begin, int32_t end, float scale, float *s,
+	float *c)
+{
+	const __m256 rad_step = _mm256_set1_ps(facet_rad);
+	const __m256 vscale = _mm256_set1_ps(scale);
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	for (int32_t facet_idx = begin; facet_idx < end; facet_idx += 8) {
+		const __m256 rad = _mm256_mul_ps(rad_step,
+			_mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(facet_idx), lanes)));
+		__m256 vs, vc;
+		sincos_avx2(rad, &vs, &vc);
+		vs = _mm256_mul_ps(vs, vscale);
+		vc = _mm256_mul_ps(vc, vscale);
+		if (end - facet_idx < 8) {
+			float ss[8], cs[8];
+			_mm256_storeu_ps(ss, vs);
+			_mm256_storeu_ps(cs, vc);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				s[facet_idx - begin + lane] = ss[lane];
+				c[facet_idx - begin + lane] = cs[lane];
+			}
+			break;
+		}
+		_mm256_storeu_ps(&s[facet_idx - begin], vs);
+		_mm256_storeu_ps(&c[facet_idx - begin], vc);
+	}
+}
+#endif
+
+#if defined(RP_HAS_NEON)
+static inline void sincos_neon(float32x4_t rad, float32x4_t *out_sin, float32x4_t *out_cos)
+{
+	const int32x4_t k = vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(rad, RP_SINCOS_2_OVER_PI), vdupq_n_f32(0.5f)));
+	const float32x4_t kf = vcvtq_f32_s32(k);
+	float32x4_t r = vmlsq_n_f32(rad, kf, RP_SINCOS_PIO2_1);
+	r = vmlsq_n_f32(r, kf, RP_SINCOS_PIO2_2);
+	r = vmlsq_n_f32(r, kf, RP_SINCOS_PIO2_3);
+	const float32x4_t r2 = vmulq_f32(r, r);
+
+	float32x4_t sin_r = vmlaq_n_f32(vdupq_n_f32(RP_SINCOS_S2), r2, RP_SINCOS_S3);
+	sin_r = vmlaq_f32(vdupq_n_f32(RP_SINCOS_S1), r2, sin_r);
+	sin_r = vmlaq_f32(r, vmulq_f32(r2, r), sin_r);
+
+	float32x4_t cos_r = vmlaq_n_f32(vdupq_n_f32(RP_SINCOS_C2), r2, RP_SINCOS_C3);
+	cos_r = vmlaq_f32(vdupq_n_f32(RP_SINCOS_C1), r2, cos_r);
+	cos_r = vmlaq_f32(vmulq_n_f32(r2, -0.5f), vmulq_f32(r2, r2), cos_r);
+	cos_r = vaddq_f32(cos_r, vdupq_n_f32(1.0f));
+
+	const uint32x4_t swap = vceqq_s32(vandq_s32(k, vdupq_n_s32(1)), vdupq_n_s32(1));
+	const float32x4_t s = vbslq_f32(swap, cos_r, sin_r);
+	const float32x4_t c = vbslq_f32(swap, sin_r, cos_r);
+	const uint32x4_t sin_sign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(k, vdupq_n_s32(2))), 30);
+	const uint32x4_t cos_sign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(vaddq_s32(k, vdupq_n_s32(1)),
+		vdupq_n_s32(2))), 30);
+	*out_sin = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(s), sin_sign));
+	*out_cos = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(c), cos_sign));
+}
+
+struct ring_consts_neon {
+	float32x2_t zr;
+	float32x2_t gb;
+	float32x2_t rg;
+	float32x2_t ba;
+	float32x2_t aa;
+	float32x2_t zz;
+};
+
+static inline void store_ring_neon(float *vertex, float32x4_t x, float32x4_t y, const struct ring_consts_neon *consts)
+{
+	const float32x4x2_t xy = vzipq_f32(x, y);
+	const float32x2_t x0_y0 = vget_low_f32(xy.val[0]);
+	const float32x2_t x1_y1 = vget_high_f32(xy.val[0]);
+	const float32x2_t x2_y2 = vget_low_f32(xy.val[1]);
+	const float32x2_t x3_y3 = vget_high_f32(xy.val[1]);
+
+	vst1q_f32(vertex + 0, vcombine_f32(x0_y0, consts->zr));
+	vst1q_f32(vertex + 4, vcombine_f32(consts->gb, vzip_f32(consts->aa, x1_y1).val[0]));
+	vst1q_f32(vertex + 8, vcombine_f32(vzip_f32(x1_y1, consts->zz).val[1], consts->rg));
+	vst1q_f32(vertex + 12, vcombine_f32(consts->ba, x2_y2));
+	vst1q_f32(vertex + 16, vcombine_f32(consts->zr, consts->gb));
+	vst1q_f32(vertex + 20, vcombine_f32(vzip_f32(consts->aa, x3_y3).val[0], vzip_f32(x3_y3, consts->zz).val[1]));
+	vst1q_f32(vertex + 24, vcombine_f32(consts->rg, consts->ba));
+}
+
+static void ring_kernel_neon(const struct ring_params *params, int32_t begin, int32_t end)
+{
+	struct ring_consts_neon consts[RP_RING_COUNT];
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		const float *color = params->ring_colors[ring];
+		const float z = params->ring_z[ring];
+		consts[ring].zr = vset_lane_f32(color[0], vdup_n_f32(z), 1);
+		consts[ring].gb = vset_lane_f32(color[2], vdup_n_f32(color[1]), 1);
+		consts[ring].rg = vset_lane_f32(color[1], vdup_n_f32(color[0]), 1);
+		consts[ring].ba = vset_lane_f32(1.0f, vdup_n_f32(color[2]), 1);
+		consts[ring].aa = vdup_n_f32(1.0f);
+		consts[ring].zz = vdup_n_f32(z);
+	}
+	const int32_t lane_init[4] = { 0, 1, 2, 3 };
+	const int32x4_t lanes = vld1q_s32(lane_init);
+
+	int32_t facet_idx = begin;
+	for (; facet_idx < end; facet_idx += 4) {
+		const float32x4_t rad = vmulq_n_f32(vcvtq_f32_s32(vaddq_s32(vdupq_n_s32(facet_idx), lanes)), params->facet_rad);
+		float32x4_t s, c;
+		if (params->unit_sin) {
+			s = vld1q_f32(&params->unit_sin[facet_idx - begin]);
+			c = vld1q_f32(&params->unit_cos[facet_idx - begin]);
+		} else {
+			sincos_neon(rad, &s, &c);
+		}
+		const float32x4_t x = vmulq_n_f32(s, params->facet_radius);
+		const float32x4_t y = vmulq_n_f32(c, params->facet_radius);
+
+		if (end - facet_idx < 4) {
+			float xs[4], ys[4];
+			vst1q_f32(xs, x);
+			vst1q_f32(ys, y);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				set_ring_vertices(params, facet_idx + lane, xs[lane], ys[lane]);
+			}
+			break;
+		}
+
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			float *vertex = &params->vertices[(ring * params->facet_count + facet_idx) * RP_VERTEX_STRIDE];
+			store_ring_neon(vertex, x, y, &consts[ring]);
+		}
+	}
+}
+
+static void sincos_kernel_neon(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c)
+{
+	const int32_t lane_init[4] = { 0, 1, 2, 3 };
+	const int32x4_t lanes = vld1q_s32(lane_init);
+	for (int32_t facet_idx = begin; facet_idx < end; facet_idx += 4) {
+		const float32x4_t rad = vmulq_n_f32(vcvtq_f32_s32(vaddq_s32(vdupq_n_s32(facet_idx), lanes)), facet_rad);
+		float32x4_t vs, vc;
+		sincos_neon(rad, &vs, &vc);
+		vs = vmulq_n_f32(vs, scale);
+		vc = vmulq_n_f32(vc, scale);
+		if (end - facet_idx < 4) {
+			float ss[4], cs[4];
+			vst1q_f32(ss, vs);
+			vst1q_f32(cs, vc);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				s[facet_idx - begin + lane] = ss[lane];
+				c[facet_idx - begin + lane] = cs[lane];
+			}
+			break;
+		}
+		vst1q_f32(&s[facet_idx - begin], vs);
+		vst1q_f32(&c[facet_idx - begin], vc);
+	}
+}
+#endif
+
+#if defined(RP_HAS_WASM_SIMD128)
+static inline void sincos_wasm(v128_t rad, v128_t *out_sin, v128_t *out_cos)
+{
+	const v128_t k = wasm_i32x4_trunc_sat_f32x4(wasm_f32x4_add(
+		wasm_f32x4_mul(rad, wasm_f32x4_splat(RP_SINCOS_2_OVER_PI)), wasm_f32x4_splat(0.5f)));
+	const v128_t kf = wasm_f32x4_convert_i32x4(k);
+	v128_t r = wasm_f32x4_sub(rad, wasm_f32x4_mul(kf, wasm_f32x4_splat(RP_SINCOS_PIO2_1)));
+	r = wasm_f32x4_sub(r, wasm_f32x4_mul(kf, wasm_f32x4_splat(RP_SINCOS_PIO2_2)));
+	r = wasm_f32x4_sub(r, wasm_f32x4_mul(kf, wasm_f32x4_splat(RP_SINCOS_PIO2_3)));
+	const v128_t r2 = wasm_f32x4_mul(r, r);
+
+	v128_t sin_r = wasm_f32x4_add(wasm_f32x4_mul(r2, wasm_f32x4_splat(RP_SINCOS_S3)), wasm_f32x4_splat(RP_SINCOS_S2));
+	sin_r = wasm_f32x4_add(wasm_f32x4_mul(r2, sin_r), wasm_f32x4_splat(RP_SINCOS_S1));
+	sin_r = wasm_f32x4_add(wasm_f32x4_mul(wasm_f32x4_mul(r2, r), sin_r), r);
+
+	v128_t cos_r = wasm_f32x4_add(wasm_f32x4_mul(r2, wasm_f32x4_splat(RP_SINCOS_C3)), wasm_f32x4_splat(RP_SINCOS_C2));
+	cos_r = wasm_f32x4_add(wasm_f32x4_mul(r2, cos_r), wasm_f32x4_splat(RP_SINCOS_C1));
+	cos_r = wasm_f32x4_sub(wasm_f32x4_mul(wasm_f32x4_mul(r2, r2), cos_r), wasm_f32x4_mul(r2, wasm_f32x4_splat(0.5f)));
+	cos_r = wasm_f32x4_add(cos_r, wasm_f32x4_splat(1.0f));
+
+	const v128_t swap = wasm_i32x4_eq(wasm_v128_and(k, wasm_i32x4_splat(1)), wasm_i32x4_splat(1));
+	const v128_t s = wasm_v128_bitselect(cos_r, sin_r, swap);
+	const v128_t c = wasm_v128_bitselect(sin_r, cos_r, swap);
+	const v128_t sin_sign = wasm_i32x4_shl(wasm_v128_and(k, wasm_i32x4_splat(2)), 30);
+	const v128_t cos_sign = wasm_i32x4_shl(wasm_v128_and(wasm_i32x4_add(k, wasm_i32x4_splat(1)),
+		wasm_i32x4_splat(2)), 30);
+	*out_sin = wasm_v128_xor(s, sin_sign);
+	*out_cos = wasm_v128_xor(c, cos_sign);
+}
+
+static inline void store_ring_wasm(float *vertex, v128_t x, v128_t y, v128_t zrgb, v128_t rgba)
+{
+	const v128_t xy_lo = wasm_i32x4_shuffle(x, y, 0, 4, 1, 5); // x0 y0 x1 y1
+	const v128_t xy_hi = wasm_i32x4_shuffle(x, y, 2, 6, 3, 7); // x2 y2 x3 y3
+	const v128_t x3_y3_z = wasm_i32x4_shuffle(xy_hi, zrgb, 2, 3, 4, 4);
+
+	wasm_v128_store(vertex + 0, wasm_i32x4_shuffle(xy_lo, zrgb, 0, 1, 4, 5));    // x0 y0 z  r
+	wasm_v128_store(vertex + 4, wasm_i32x4_shuffle(rgba, xy_lo, 1, 2, 3, 6));    // g  b  a  x1
+	wasm_v128_store(vertex + 8, wasm_i32x4_shuffle(xy_lo, zrgb, 3, 4, 5, 6));    // y1 z  r  g
+	wasm_v128_store(vertex + 12, wasm_i32x4_shuffle(rgba, xy_hi, 2, 3, 4, 5));   // b  a  x2 y2
+	wasm_v128_store(vertex + 16, zrgb);                                          // z  r  g  b
+	wasm_v128_store(vertex + 20, wasm_i32x4_shuffle(rgba, x3_y3_z, 3, 4, 5, 6)); // a  x3 y3 z
+	wasm_v128_store(vertex + 24, rgba);                                          // r  g  b  a
+}
+
+static void ring_kernel_wasm(const struct ring_params *params, int32_t begin, int32_t end)
+{
+	v128_t zrgb[RP_RING_COUNT];
+	v128_t rgba[RP_RING_COUNT];
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		const float *color = params->ring_colors[ring];
+		zrgb[ring] = wasm_f32x4_make(params->ring_z[ring], color[0], color[1], color[2]);
+		rgba[ring] = wasm_f32x4_make(color[0], color[1], color[2], 1.0f);
+	}
+	const v128_t facet_rad = wasm_f32x4_splat(params->facet_rad);
+	const v128_t facet_radius = wasm_f32x4_splat(params->facet_radius);
+	const v128_t lanes = wasm_i32x4_make(0, 1, 2, 3);
+
+	int32_t facet_idx = begin;
+	for (; facet_idx < end; facet_idx += 4) {
+		const v128_t rad = wasm_f32x4_mul(facet_rad,
+			wasm_f32x4_convert_i32x4(wasm_i32x4_add(wasm_i32x4_splat(facet_idx), lanes)));
+		v128_t s, c;
+		if (params->unit_sin) {
+			s = wasm_v128_load(&params->unit_sin[facet_idx - begin]);
+			c = wasm_v128_load(&params->unit_cos[facet_idx - begin]);
+		} else {
+			sincos_wasm(rad, &s, &c);
+		}
+		const v128_t x = wasm_f32x4_mul(s, facet_radius);
+		const v128_t y = wasm_f32x4_mul(c, facet_radius);
+
+		if (end - facet_idx < 4) {
+			float xs[4], ys[4];
+			wasm_v128_store(xs, x);
+			wasm_v128_store(ys, y);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				set_ring_vertices(params, facet_idx + lane, xs[lane], ys[lane]);
+			}
+			break;
+		}
+
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			float *vertex = &params->vertices[(ring * params->facet_count + facet_idx) * RP_VERTEX_STRIDE];
+			store_ring_wasm(vertex, x, y, zrgb[ring], rgba[ring]);
+		}
+	}
+}
+
+static void sincos_kernel_wasm(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c)
+{
+	const v128_t rad_step = wasm_f32x4_splat(facet_rad);
+	const v128_t vscale = wasm_f32x4_splat(scale);
+	const v128_t lanes = wasm_i32x4_make(0, 1, 2, 3);
+	for (int32_t facet_idx = begin; facet_idx < end; facet_idx += 4) {
+		const v128_t rad = wasm_f32x4_mul(rad_step,
+			wasm_f32x4_convert_i32x4(wasm_i32x4_add(wasm_i32x4_splat(facet_idx), lanes)));
+		v128_t vs, vc;
+		sincos_wasm(rad, &vs, &vc);
+		vs = wasm_f32x4_mul(vs, vscale);
+		vc = wasm_f32x4_mul(vc, vscale);
+		if (end - facet_idx < 4) {
+			float ss[4], cs[4];
+			wasm_v128_store(ss, vs);
+			wasm_v128_store(cs, vc);
+			for (int32_t lane = 0; lane < end - facet_idx; ++lane) {
+				s[facet_idx - begin + lane] = ss[lane];
+				c[facet_idx - begin + lane] = cs[lane];
+			}
+			break;
+		}
+		wasm_v128_store(&s[facet_idx - begin], vs);
+		wasm_v128_store(&c[facet_idx - begin], vc);
+	}
+}
+#endif
+
+static bool kernel_available(enum rp_kernel kernel)
+{
+	switch (kernel) {
+	case RP_KERNEL_SCALAR:
+		return true;
+#if defined(RP_HAS_SSE2)
+	case RP_KERNEL_SSE2:
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse2");
+#else
+		return true;
+#endif
+#endif
+#if defined(RP_HAS_AVX2)
+	case RP_KERNEL_AVX2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#if defined(RP_HAS_NEON)
+	case RP_KERNEL_NEON:
+		return true;
+#endif
+#if defined(RP_HAS_WASM_SIMD128)
+	case RP_KERNEL_WASM_SIMD128:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+static const struct kernel_fns *kernel_fns(enum rp_kernel kernel)
+{
+	static const struct kernel_fns scalar = { ring_kernel_scalar, sincos_kernel_scalar };
+#if defined(RP_HAS_SSE2)
+	static const struct kernel_fns sse2 = { ring_kernel_sse2, sincos_kernel_sse2 };
+#endif
+#if defined(RP_HAS_AVX2)
+	static const struct kernel_fns avx2 = { ring_kernel_avx2, sincos_kernel_avx2 };
+#endif
+#if defined(RP_HAS_NEON)
+	static const struct kernel_fns neon = { ring_kernel_neon, sincos_kernel_neon };
+#endif
+#if defined(RP_HAS_WASM_SIMD128)
+	static const struct kernel_fns wasm = { ring_kernel_wasm, sincos_kernel_wasm };
+#endif
+	switch (kernel) {
+#if defined(RP_HAS_SSE2)
+	case RP_KERNEL_SSE2: return &sse2;
+#endif
+#if defined(RP_HAS_AVX2)
+	case RP_KERNEL_AVX2: return &avx2;
+#endif
+#if defined(RP_HAS_NEON)
+	case RP_KERNEL_NEON: return &neon;
+#endif
+#if defined(RP_HAS_WASM_SIMD128)
+	case RP_KERNEL_WASM_SIMD128: return &wasm;
+#endif
+	default: return &scalar;
+	}
+}
+
+// resolved on first use. racing first calls all resolve to the same kernel, so relaxed atomics are enough; they
+// only keep the concurrent accesses defined
+static _Atomic enum rp_kernel active_kernel = RP_KERNEL_AUTO;
+
+static enum rp_kernel resolve_kernel(void)
+{
+	static const enum rp_kernel preference[] = {
+		RP_KERNEL_AVX2, RP_KERNEL_SSE2, RP_KERNEL_NEON, RP_KERNEL_WASM_SIMD128
+	};
+	for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); ++i) {
+		if (kernel_available(preference[i])) return preference[i];
+	}
+	return RP_KERNEL_SCALAR;
+}
+
+bool rp_set_kernel(enum rp_kernel kernel)
+{
+	if (kernel == RP_KERNEL_AUTO) {
+		atomic_store_explicit(&active_kernel, resolve_kernel(), memory_order_relaxed);
+		return true;
+	}
+	if (!kernel_available(kernel)) return false;
+	atomic_store_explicit(&active_kernel, kernel, memory_order_relaxed);
+	return true;
+}
+
+enum rp_kernel rp_get_kernel(void)
+{
+	enum rp_kernel kernel = atomic_load_explicit(&active_kernel, memory_order_relaxed);
+	if (kernel == RP_KERNEL_AUTO) {
+		kernel = resolve_kernel();
+		atomic_store_explicit(&active_kernel, kernel, memory_order_relaxed);
+	}
+	return kernel;
+}
+
+// coarse precision: libm seeds for the first RP_COARSE_LANES facets, then every position is the one
+// RP_COARSE_LANES facets earlier rotated by that many steps. the recurrence's dependency distance is
+// RP_COARSE_LANES, so it vectorizes as plain c, and its error grows with the run length, which the ring
+// generator caps at RP_SYMMETRY_CHUNK facets. the seeds come from the scalar kernel whatever kernel is active, so
+// coarse values (and the cached unit tables keyed by this function) don't depend on rp_set_kernel.
+#define RP_COARSE_LANES 8
+
+static void sincos_kernel_coarse(float facet_rad, int32_t begin, int32_t end, float scale, float *s, float *c)
+{
+	const int32_t count = end - begin;
+	sincos_kernel_scalar(facet_rad, begin, count < RP_COARSE_LANES ? end : begin + RP_COARSE_LANES, scale, s, c);
+	const float rot_s = sinf(facet_rad * RP_COARSE_LANES);
+	const float rot_c = cosf(facet_rad * RP_COARSE_LANES);
+	for (int32_t i = RP_COARSE_LANES; i < count; ++i) {
+		s[i] = s[i - RP_COARSE_LANES] * rot_c + c[i - RP_COARSE_LANES] * rot_s;
+		c[i] = c[i - RP_COARSE_LANES] * rot_c - s[i - RP_COARSE_LANES] * rot_s;
+	}
+}
+
+// the kernels a precision tier runs on; coarse only ever drives the ring kernel with unit values
+static struct kernel_fns precision_fns(enum rp_precision precision)
+{
+	switch (precision) {
+	case RP_PRECISION_EXACT: return *kernel_fns(RP_KERNEL_SCALAR);
+	case RP_PRECISION_COARSE: return (struct kernel_fns){ kernel_fns(rp_get_kernel())->ring, sincos_kernel_coarse };
+	default: return *kernel_fns(rp_get_kernel());
+	}
+}
+
+// symmetric ring generation
+//
+// a regular polygon with an even facet count maps onto itself under the reflections i -> n - i and i -> n/2 - i,
+// and with a multiple of 4 facets also under i -> n/4 - i. so only the fundamental domain, the first quarter or
+// eighth of the circle, is evaluated; every base chunk is then handed out as up to 8 runs of facets holding the
+// same values swapped and negated. that's exact, so mirrored vertices are exactly symmetric and every sin/cos
+// argument stays below pi/2 (pi/4). odd facet counts have no such symmetry and are evaluated facet by facet.
+
+#define RP_UNIT_PADDING 8 // the widest ring kernel loads 8 unit values at its last facet
+#define RP_SYMMETRY_CHUNK 1024
+// the coarse error bound documented in rp_gen.h holds for recurrences of at most this many steps per run (bench
+// precision sweeps it); longer runs need it measured again
+_Static_assert(RP_SYMMETRY_CHUNK / RP_COARSE_LANES <= 128, "coarse runs are longer than its error bound covers");
+
+static inline bool ring_symmetric(int32_t facet_count)
+{
+	return facet_count % 2 == 0;
+}
 
+// the facet of base facet j is quarter * facet_count / 4 + direction * j
+struct ring_image {
+	int32_t quarter;
+	int32_t direction;
+	bool swap;
+	float sin_sign;
+	float cos_sign;
+};
+
+static const struct ring_image ring_images[8] = {
+	{ 0, 1, false, 1.0f, 1.0f },   // phi
+	{ 1, -1, true, 1.0f, 1.0f },   // pi/2 - phi
+	{ 1, 1, true, 1.0f, -1.0f },   // pi/2 + phi
+	{ 2, -1, false, 1.0f, -1.0f }, // pi - phi
+	{ 2, 1, false, -1.0f, -1.0f }, // pi + phi
+	{ 3, -1, true, -1.0f, -1.0f }, // 3pi/2 - phi
+	{ 3, 1, true, -1.0f, 1.0f },   // 3pi/2 + phi
+	{ 4, -1, false, -1.0f, 1.0f }  // 2pi - phi
+};
+
+// without the quarter turn reflection only these images exist
+static const int32_t half_images[4] = { 0, 3, 4, 7 };
+
+struct unit_fill {
+	int32_t begin;
+	float *s;
+	float *c;
+};
+
+// receives the circle positions of facets [begin, end); s and c are padded by RP_UNIT_PADDING
+typedef void (*ring_run_fn)(void *ctx, int32_t begin, int32_t end, const float *s, const float *c);
+
+// hands the unit circle positions of facets [begin, end) to fn in runs of at most RP_SYMMETRY_CHUNK facets. runs come
+// in no particular order and the facets on a symmetry axis may come twice with equal values (up to the sign of zero);
+// which run comes last for such a facet doesn't depend on begin and end. a NULL fn writes the runs straight into the
+// struct unit_fill passed as ctx instead.
+static void for_ring_runs(sincos_kernel sincos, int32_t facet_count, int32_t begin, int32_t end, ring_run_fn fn,
+	void *ctx)
+{
 	const float facet_rad = RP_PI32 * 2.0f / (float)facet_count;
+	const struct unit_fill *fill = ctx;
+	float base_s[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
+	float base_c[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
 
-	const float front_face_color_r = 1.0f;
-	const float front_face_color_g = 0.0f;
-	const float front_face_color_b = 0.0f;
+	if (!ring_symmetric(facet_count)) {
+		// chunked even when filling: coarse runs its recurrence over one sincos call. it seeds the recurrence where a
+		// chunk starts, so its chunks start at multiples of RP_SYMMETRY_CHUNK whatever begin is, and the facets
+		// before begin are evaluated but not handed out
+		const int32_t first_chunk = sincos == sincos_kernel_coarse ? begin - begin % RP_SYMMETRY_CHUNK : begin;
+		for (int32_t chunk_begin = first_chunk; chunk_begin < end; chunk_begin += RP_SYMMETRY_CHUNK) {
+			const int32_t chunk_end = end - chunk_begin < RP_SYMMETRY_CHUNK ? end : chunk_begin + RP_SYMMETRY_CHUNK;
+			const int32_t skip = chunk_begin < begin ? begin - chunk_begin : 0;
+			if (!fn && skip == 0) {
+				sincos(facet_rad, chunk_begin, chunk_end, 1.0f, fill->s + (chunk_begin - fill->begin),
+					fill->c + (chunk_begin - fill->begin));
+				continue;
+			}
+			sincos(facet_rad, chunk_begin, chunk_end, 1.0f, base_s, base_c);
+			if (fn) {
+				fn(ctx, chunk_begin + skip, chunk_end, base_s + skip, base_c + skip);
+				continue;
+			}
+			const size_t run_bytes = (size_t)(chunk_end - begin) * sizeof(float);
+			memcpy(fill->s + (begin - fill->begin), base_s + skip, run_bytes);
+			memcpy(fill->c + (begin - fill->begin), base_c + skip, run_bytes);
+		}
+		return;
+	}
 
-	const float back_face_color_r = 0.0f;
-	const float back_face_color_g = 0.0f;
-	const float back_face_color_b = 1.0f;
+	const bool octants = facet_count % 4 == 0;
+	const int32_t domain_end = (octants ? facet_count / 8 : facet_count / 4) + 1;
+	const int32_t image_count = octants ? 8 : 4;
+	float run_s[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
+	float run_c[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
 
-	const float edge_color_r = 0.0f;
-	const float edge_color_g = 1.0f;
-	const float edge_color_b = 0.0f;
+	for (int32_t j0 = 0; j0 < domain_end; j0 += RP_SYMMETRY_CHUNK) {
+		const int32_t j1 = domain_end - j0 < RP_SYMMETRY_CHUNK ? domain_end : j0 + RP_SYMMETRY_CHUNK;
+		bool evaluated = false;
 
-	int32_t vertex_offset = 0;
+		for (int32_t image_idx = 0; image_idx < image_count; ++image_idx) {
+			const struct ring_image *image = &ring_images[octants ? image_idx : half_images[image_idx]];
+			const int32_t offset = image->quarter * facet_count / 4;
+			int32_t run_begin = image->direction > 0 ? offset + j0 : offset - j1 + 1;
+			int32_t run_end = image->direction > 0 ? offset + j1 : offset - j0 + 1;
+			if (run_begin < begin) run_begin = begin;
+			if (run_end > end) run_end = end;
+			if (run_begin >= run_end) continue;
 
-	// front facet vertices
-	int32_t front_facet_start_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	for (int32_t facet_idx = 0; facet_idx < facet_count; ++facet_idx) {
-		int32_t idx = facet_idx * RP_VERTEX_STRIDE + vertex_offset;
-		float rad = facet_rad * facet_idx;
-		vertices[idx + 0] = sinf(rad) * facet_radius;
-		vertices[idx + 1] = cosf(rad) * facet_radius;
-		vertices[idx + 2] = 0.0f;
-		vertices[idx + 3] = front_face_color_r;
-		vertices[idx + 4] = front_face_color_g;
-		vertices[idx + 5] = front_face_color_b;
-		vertices[idx + 6] = 1.0f;
-	}
-	vertex_offset += (facet_count * RP_VERTEX_STRIDE);
-
-	// front edge vertices
-	int32_t front_edge_start_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	for (int32_t facet_idx = 0; facet_idx < facet_count; ++facet_idx) {
-		int32_t idx = facet_idx * RP_VERTEX_STRIDE + vertex_offset;
-		float rad = facet_rad * facet_idx;
-		vertices[idx + 0] = sinf(rad) * facet_radius;
-		vertices[idx + 1] = cosf(rad) * facet_radius;
-		vertices[idx + 2] = 0.0f;
-		vertices[idx + 3] = edge_color_r;
-		vertices[idx + 4] = edge_color_g;
-		vertices[idx + 5] = edge_color_b;
-		vertices[idx + 6] = 1.0f;
-	}
-	vertex_offset += (facet_count * RP_VERTEX_STRIDE);
-
-	// back facet vertices
-	int32_t back_facet_start_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	for (int32_t facet_idx = 0; facet_idx < facet_count; ++facet_idx) {
-		int32_t idx = facet_idx * RP_VERTEX_STRIDE + vertex_offset;
-		float rad = facet_rad * facet_idx;
-		vertices[idx + 0] = sinf(rad) * facet_radius;
-		vertices[idx + 1] = cosf(rad) * facet_radius;
-		vertices[idx + 2] = -extrusion_depth;
-		vertices[idx + 3] = back_face_color_r;
-		vertices[idx + 4] = back_face_color_g;
-		vertices[idx + 5] = back_face_color_b;
-		vertices[idx + 6] = 1.0f;
-	}
-	vertex_offset += (facet_count * RP_VERTEX_STRIDE);
-
-	// back edge vertices
-	int32_t back_edge_start_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	for (int32_t facet_idx = 0; facet_idx < facet_count; ++facet_idx) {
-		int32_t idx = facet_idx * RP_VERTEX_STRIDE + vertex_offset;
-		float rad = facet_rad * facet_idx;
-		vertices[idx + 0] = sinf(rad) * facet_radius;
-		vertices[idx + 1] = cosf(rad) * facet_radius;
-		vertices[idx + 2] = -extrusion_depth;
-		vertices[idx + 3] = edge_color_r;
-		vertices[idx + 4] = edge_color_g;
-		vertices[idx + 5] = edge_color_b;
-		vertices[idx + 6] = 1.0f;
-	}
-	vertex_offset += (facet_count * RP_VERTEX_STRIDE);
-
-	// front center vertex
-	int32_t front_center_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	vertices[vertex_offset + 0] = 0.0f;
-	vertices[vertex_offset + 1] = 0.0f;
-	vertices[vertex_offset + 2] = 0.0f;
-	vertices[vertex_offset + 3] = front_face_color_r;
-	vertices[vertex_offset + 4] = front_face_color_g;
-	vertices[vertex_offset + 5] = front_face_color_b;
-	vertices[vertex_offset + 6] = 1.0f;
-	vertex_offset += RP_VERTEX_STRIDE;
-
-	// back center vertex
-	int32_t back_center_vertex = vertex_offset / RP_VERTEX_STRIDE;
-	vertices[vertex_offset + 0] = 0.0f;
-	vertices[vertex_offset + 1] = 0.0f;
-	vertices[vertex_offset + 2] = -extrusion_depth;
-	vertices[vertex_offset + 3] = back_face_color_r;
-	vertices[vertex_offset + 4] = back_face_color_g;
-	vertices[vertex_offset + 5] = back_face_color_b;
-	vertices[vertex_offset + 6] = 1.0f;
-	vertex_offset += RP_VERTEX_STRIDE;
-
-	int32_t index_offset = 0;
-
-	// front face indices
-	for (uint16_t i = 0; i < facet_count; i += 1) {
-		int32_t idx = index_offset + i * RP_INDEX_STRIDE;
-		indices[idx + 0] = front_center_vertex;
-		indices[idx + 1] = front_facet_start_vertex + i;
-		indices[idx + 2] = front_facet_start_vertex + (i + 1) % facet_count;
-	}
-	index_offset += facet_count * RP_INDEX_STRIDE;
-
-	// back face indices
-	for (uint16_t i = 0; i < facet_count; i += 1) {
-		int32_t idx = index_offset + i * RP_INDEX_STRIDE;
-		indices[idx + 0] = back_center_vertex;
-		indices[idx + 1] = back_facet_start_vertex + (i + 1) % facet_count;
-		indices[idx + 2] = back_facet_start_vertex + i;
-	}
-	index_offset += facet_count * RP_INDEX_STRIDE;
-
-	// edge indices
-	for (uint16_t i = 0; i < facet_count; i += 1) {
-		uint16_t start_vertex = (uint16_t)front_edge_start_vertex + i;
-		uint16_t end_vertex = (uint16_t)back_edge_start_vertex + (i + 1) % facet_count;
-		int32_t idx = index_offset + i * (RP_INDEX_STRIDE * 2);
-		indices[idx + 0] = start_vertex;
-		indices[idx + 1] = (uint16_t)back_edge_start_vertex + i;
-		indices[idx + 2] = end_vertex;
-		indices[idx + 3] = end_vertex;
-		indices[idx + 4] = (uint16_t)front_edge_start_vertex + (i + 1) % facet_count;
-		indices[idx + 5] = start_vertex;
-	}
-	index_offset += facet_count * (RP_INDEX_STRIDE * 2);
+			if (!evaluated) {
+				sincos(facet_rad, j0, j1, 1.0f, base_s, base_c);
+				// the diagonal at pi/4 is its own mirror image, so its sin and cos must match exactly
+				if (facet_count % 8 == 0 && facet_count / 8 < j1) {
+					base_s[facet_count / 8 - j0] = base_c[facet_count / 8 - j0];
+				}
+				evaluated = true;
+			}
+			const float *from_s = image->swap ? base_c : base_s;
+			const float *from_c = image->swap ? base_s : base_c;
+			float *to_s = fn ? run_s : fill->s + (run_begin - fill->begin);
+			float *to_c = fn ? run_c : fill->c + (run_begin - fill->begin);
+			const int32_t run_count = run_end - run_begin;
+			const float sin_sign = image->sin_sign;
+			const float cos_sign = image->cos_sign;
+			if (image->direction > 0) {
+				const float *src_s = from_s + (run_begin - offset - j0);
+				const float *src_c = from_c + (run_begin - offset - j0);
+				for (int32_t i = 0; i < run_count; ++i) {
+					to_s[i] = sin_sign * src_s[i];
+					to_c[i] = cos_sign * src_c[i];
+				}
+			} else {
+				const float *src_s = from_s + (offset - run_begin - j0);
+				const float *src_c = from_c + (offset - run_begin - j0);
+				for (int32_t i = 0; i < run_count; ++i) {
+					to_s[i] = sin_sign * src_s[-i];
+					to_c[i] = cos_sign * src_c[-i];
+				}
+			}
+			if (fn) fn(ctx, run_begin, run_end, run_s, run_c);
+		}
+	}
+}
 
-	return;
+// allocators
+//
+// objects copy their desc's allocator; mem_* route through it. free gets the size and alignment back, so arenas and
+// pools need no headers.
+
+static inline size_t align_size(size_t size, size_t alignment)
+{
+	return (size + alignment - 1) & ~(alignment - 1);
+}
+
+static void *default_alloc(size_t size, size_t alignment, void *user_data)
+{
+	(void)user_data;
+	if (alignment <= _Alignof(max_align_t)) return malloc(size);
+	return aligned_alloc(alignment, align_size(size, alignment));
+}
+
+static void default_free(void *ptr, size_t size, size_t alignment, void *user_data)
+{
+	(void)size;
+	(void)alignment;
+	(void)user_data;
+	free(ptr);
+}
+
+static struct rp_allocator allocator_or_default(const struct rp_allocator *allocator)
+{
+	if (allocator) {
+		assert(allocator->alloc && allocator->free);
+		return *allocator;
+	}
+	return (struct rp_allocator){ .alloc = default_alloc, .free = default_free };
+}
+
+static inline void *mem_alloc(const struct rp_allocator *allocator, size_t size, size_t alignment)
+{
+	return allocator->alloc(size, alignment, allocator->user_data);
+}
+
+static void *mem_calloc(const struct rp_allocator *allocator, size_t size, size_t alignment)
+{
+	void *ptr = allocator->alloc(size, alignment, allocator->user_data);
+	if (ptr) memset(ptr, 0, size);
+	return ptr;
+}
+
+static inline void mem_free(const struct rp_allocator *allocator, void *ptr, size_t size, size_t alignment)
+{
+	if (ptr) allocator->free(ptr, size, alignment, allocator->user_data);
+}
+
+void rp_arena_init(struct rp_arena *arena, void *memory, size_t capacity)
+{
+	assert(arena && (memory || capacity == 0));
+	*arena = (struct rp_arena){ .memory = memory, .capacity = capacity };
+}
+
+void *rp_arena_alloc(struct rp_arena *arena, size_t size, size_t alignment)
+{
+	assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+	// align the address rather than the offset, the arena's memory may be less aligned than the request
+	const uintptr_t base = (uintptr_t)arena->memory;
+	const size_t offset = align_size(base + arena->used, alignment) - base;
+	if (offset > arena->capacity || size > arena->capacity - offset) return NULL;
+	arena->used = offset + size;
+	if (arena->used > arena->peak) arena->peak = arena->used;
+	return arena->memory + offset;
+}
+
+void rp_arena_reset(struct rp_arena *arena)
+{
+	arena->used = 0;
+}
+
+static void *arena_alloc(size_t size, size_t alignment, void *user_data)
+{
+	return rp_arena_alloc(user_data, size, alignment);
+}
+
+static void arena_free(void *ptr, size_t size, size_t alignment, void *user_data)
+{
+	(void)ptr;
+	(void)size;
+	(void)alignment;
+	(void)user_data;
+}
+
+struct rp_allocator rp_arena_allocator(struct rp_arena *arena)
+{
+	return (struct rp_allocator){ .alloc = arena_alloc, .free = arena_free, .user_data = arena };
+}
+
+void rp_fixed_pool_init(struct rp_fixed_pool *pool, void *memory, size_t capacity, size_t block_size)
+{
+	assert(pool && block_size > 0);
+	assert(((uintptr_t)memory & (RP_FIXED_POOL_ALIGNMENT - 1)) == 0);
+	block_size = align_size(block_size, RP_FIXED_POOL_ALIGNMENT);
+	*pool = (struct rp_fixed_pool){
+		.memory = memory,
+		.block_size = block_size,
+		.block_count = (uint32_t)(capacity / block_size)
+	};
+	// threaded back to front so the first allocations come from the start of the memory
+	for (uint32_t i = pool->block_count; i-- > 0;) {
+		rp_fixed_pool_free(pool, pool->memory + (size_t)i * block_size);
+	}
+}
+
+void *rp_fixed_pool_alloc(struct rp_fixed_pool *pool)
+{
+	void *block = pool->free_list;
+	if (!block) return NULL;
+	memcpy(&pool->free_list, block, sizeof(void *));
+	--pool->free_count;
+	return block;
+}
+
+void rp_fixed_pool_free(struct rp_fixed_pool *pool, void *block)
+{
+	if (!block) return;
+	assert((uint8_t *)block >= pool->memory && (uint8_t *)block < pool->memory + (size_t)pool->block_count *
+		pool->block_size && ((size_t)((uint8_t *)block - pool->memory) % pool->block_size) == 0);
+	memcpy(block, &pool->free_list, sizeof(void *));
+	pool->free_list = block;
+	++pool->free_count;
+}
+
+static void *fixed_pool_alloc(size_t size, size_t alignment, void *user_data)
+{
+	struct rp_fixed_pool *pool = user_data;
+	if (size > pool->block_size || alignment > RP_FIXED_POOL_ALIGNMENT) return NULL;
+	return rp_fixed_pool_alloc(pool);
+}
+
+static void fixed_pool_free(void *ptr, size_t size, size_t alignment, void *user_data)
+{
+	(void)size;
+	(void)alignment;
+	rp_fixed_pool_free(user_data, ptr);
+}
+
+struct rp_allocator rp_fixed_pool_allocator(struct rp_fixed_pool *pool)
+{
+	return (struct rp_allocator){ .alloc = fixed_pool_alloc, .free = fixed_pool_free, .user_data = pool };
 }
 
+// facet table cache
+//
+// facet tables are what every mesh of a facet count shares whatever its radius and depth: the unit circle (sin/cos
+// per facet) and the index patterns. a table is one allocation: the header, then its data. unit circles hold the
+// sin and cos arrays, each padded so the widest kernel can load a full vector at the last facet. tables sit on a
+// list in most recently used order; lookups walk it, which is plenty for the handful of facet counts an app uses.
+// a mutex guards the list and the counters. tables are immutable once built and pinned by a reference count while
+// a generator reads them, so eviction and invalidation only unlist a pinned table and the last release frees it.
+
+#define RP_TABLE_DEFAULT_BUDGET ((size_t)1 << 20)
+
+enum table_kind {
+	TABLE_UNIT_CIRCLE,
+	TABLE_INDICES
+};
+
+struct facet_table {
+	struct facet_table *prev;
+	struct facet_table *next;
+	enum table_kind kind;
+	int32_t facet_count;
+	sincos_kernel sincos;          // unit circles: the kernel that built it, so cached output matches uncached
+	enum rp_topology topology;     // index patterns
+	enum rp_index_type index_type; // index patterns
+	uint32_t refs;
+	bool listed;
+	size_t bytes;
+	const float *sin;
+	const float *cos;
+};
+
+struct rp_table_cache {
+	struct rp_allocator allocator;
+	size_t byte_budget;
+	struct facet_table *head; // most recently used
+	struct facet_table *tail;
+	struct rp_table_cache_stats stats;
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_t mutex;
+#endif
+};
+
+static inline void table_cache_lock(struct rp_table_cache *cache)
+{
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_lock(&cache->mutex);
+#else
+	(void)cache;
+#endif
+}
+
+static inline void table_cache_unlock(struct rp_table_cache *cache)
+{
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_unlock(&cache->mutex);
+#else
+	(void)cache;
+#endif
+}
+
+static struct facet_table *table_alloc(struct rp_table_cache *cache, size_t bytes)
+{
+	return mem_calloc(&cache->allocator, bytes, _Alignof(struct facet_table));
+}
+
+static void table_free(struct rp_table_cache *cache, struct facet_table *table)
+{
+	mem_free(&cache->allocator, table, table->bytes, _Alignof(struct facet_table));
+}
+
+static void table_cache_push_front(struct rp_table_cache *cache, struct facet_table *table)
+{
+	table->prev = NULL;
+	table->next = cache->head;
+	if (cache->head) cache->head->prev = table;
+	cache->head = table;
+	if (!cache->tail) cache->tail = table;
+}
+
+static void table_cache_unlink(struct rp_table_cache *cache, struct facet_table *table)
+{
+	if (table->prev) table->prev->next = table->next; else cache->head = table->next;
+	if (table->next) table->next->prev = table->prev; else cache->tail = table->prev;
+}
+
+// takes a table off the list; the caller frees it unless it is pinned
+static void table_cache_remove(struct rp_table_cache *cache, struct facet_table *table)
+{
+	table_cache_unlink(cache, table);
+	table->listed = false;
+	cache->stats.bytes -= table->bytes;
+	--cache->stats.table_count;
+}
+
+// evicts unpinned tables from the cold end until bytes more fit the budget; false if they still don't
+static bool table_cache_make_room(struct rp_table_cache *cache, size_t bytes)
+{
+	if (bytes > cache->byte_budget) return false;
+	struct facet_table *table = cache->tail;
+	while (table && cache->stats.bytes + bytes > cache->byte_budget) {
+		struct facet_table *prev = table->prev;
+		if (table->refs == 0) {
+			table_cache_remove(cache, table);
+			table_free(cache, table);
+			++cache->stats.evictions;
+		}
+		table = prev;
+	}
+	return cache->stats.bytes + bytes <= cache->byte_budget;
+}
+
+static inline bool table_matches(const struct facet_table *table, const struct facet_table *key)
+{
+	return table->kind == key->kind && table->facet_count == key->facet_count && table->sincos == key->sincos &&
+		table->topology == key->topology && table->index_type == key->index_type;
+}
+
+// fills in the data behind a new table whose key fields are set
+typedef void (*table_build_fn)(struct facet_table *table);
+
+// returns the pinned table matching key, building it with data_bytes of data on a miss. a miss builds under the
+// lock, so concurrent ranges of one mesh wait for a single build instead of racing. NULL if the table can't be
+// cached; the caller then computes the data as usual.
+static struct facet_table *table_cache_acquire(struct rp_table_cache *cache, const struct facet_table *key,
+	size_t data_bytes, table_build_fn build)
+{
+	table_cache_lock(cache);
+
+	struct facet_table *table = cache->head;
+	while (table && !table_matches(table, key)) {
+		table = table->next;
+	}
+
+	if (table) {
+		++cache->stats.hits;
+		table_cache_unlink(cache, table);
+		table_cache_push_front(cache, table);
+	} else {
+		++cache->stats.misses;
+		const size_t bytes = sizeof(struct facet_table) + data_bytes;
+		if (table_cache_make_room(cache, bytes) && (table = table_alloc(cache, bytes)) != NULL) {
+			*table = *key;
+			table->listed = true;
+			table->bytes = bytes;
+			build(table);
+			table_cache_push_front(cache, table);
+			cache->stats.bytes += bytes;
+			++cache->stats.table_count;
+		}
+	}
+
+	if (table) ++table->refs;
+	table_cache_unlock(cache);
+	return table;
+}
+
+static void build_unit_circle(struct facet_table *table)
+{
+	const size_t padded = (size_t)table->facet_count + RP_UNIT_PADDING;
+	float *values = (float *)(table + 1);
+	struct unit_fill fill = { .begin = 0, .s = values, .c = values + padded };
+	for_ring_runs(table->sincos, table->facet_count, 0, table->facet_count, NULL, &fill);
+	table->sin = values;
+	table->cos = values + padded;
+}
+
+static struct facet_table *table_cache_acquire_unit_circle(struct rp_table_cache *cache, int32_t facet_count,
+	sincos_kernel sincos)
+{
+	const struct facet_table key = { .kind = TABLE_UNIT_CIRCLE, .facet_count = facet_count, .sincos = sincos };
+	const size_t padded = (size_t)facet_count + RP_UNIT_PADDING;
+	return table_cache_acquire(cache, &key, padded * 2 * sizeof(float), build_unit_circle);
+}
+
+static void table_cache_release(struct rp_table_cache *cache, struct facet_table *table)
+{
+	if (!table) return;
+	table_cache_lock(cache);
+	const bool unused = --table->refs == 0 && !table->listed;
+	table_cache_unlock(cache);
+	if (unused) table_free(cache, table);
+}
+
+struct rp_table_cache *rp_table_cache_create(const struct rp_table_cache_desc *desc)
+{
+	const struct rp_allocator allocator = allocator_or_default(desc ? desc->allocator : NULL);
+	struct rp_table_cache *cache = mem_calloc(&allocator, sizeof(struct rp_table_cache),
+		_Alignof(struct rp_table_cache));
+	if (!cache) return NULL;
+	cache->allocator = allocator;
+	cache->byte_budget = desc && desc->byte_budget ? desc->byte_budget : RP_TABLE_DEFAULT_BUDGET;
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_init(&cache->mutex, NULL);
+#endif
+	return cache;
+}
+
+// no generator may be using the cache
+void rp_table_cache_destroy(struct rp_table_cache *cache)
+{
+	if (!cache) return;
+	struct facet_table *table = cache->head;
+	while (table) {
+		struct facet_table *next = table->next;
+		assert(table->refs == 0);
+		table_free(cache, table);
+		table = next;
+	}
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_destroy(&cache->mutex);
+#endif
+	const struct rp_allocator allocator = cache->allocator;
+	mem_free(&allocator, cache, sizeof(struct rp_table_cache), _Alignof(struct rp_table_cache));
+}
+
+void rp_table_cache_invalidate(struct rp_table_cache *cache, int32_t facet_count)
+{
+	table_cache_lock(cache);
+	struct facet_table *table = cache->head;
+	while (table) {
+		struct facet_table *next = table->next;
+		if (facet_count == 0 || table->facet_count == facet_count) {
+			table_cache_remove(cache, table);
+			if (table->refs == 0) table_free(cache, table);
+		}
+		table = next;
+	}
+	table_cache_unlock(cache);
+}
+
+struct rp_table_cache_stats rp_table_cache_get_stats(struct rp_table_cache *cache)
+{
+	table_cache_lock(cache);
+	const struct rp_table_cache_stats stats = cache->stats;
+	table_cache_unlock(cache);
+	return stats;
+}
+
+struct mesh_params {
+	int32_t facet_count;
+	float facet_radius;
+	float extrusion_depth;
+	const struct rp_vertex_layout *layout; // NULL for the default interleaved layout
+	const struct rp_soa *soa;              // non-NULL replaces the vertex block with separate streams
+	const float (*ring_colors)[3];
+	enum rp_precision precision;
+	struct rp_table_cache *table_cache;    // optional
+	const struct facet_table *table;        // set by gen_vertices when the cache has the unit circle
+};
+
+// custom vertex layouts
+
+static const int32_t attr_component_counts[RP_ATTR_NUM] = {
+	[RP_ATTR_POSITION] = 3,
+	[RP_ATTR_NORMAL] = 3,
+	[RP_ATTR_UV] = 2,
+	[RP_ATTR_COLOR] = 4,
+	[RP_ATTR_FACET_ID] = 1,
+	[RP_ATTR_BACK] = 1
+};
+
+static const uint32_t format_sizes[RP_FORMAT_NUM] = {
+	[RP_FORMAT_NONE] = 0,
+	[RP_FORMAT_F32] = 4,
+	[RP_FORMAT_F16] = 2,
+	[RP_FORMAT_SNORM16] = 2,
+	[RP_FORMAT_UNORM8] = 1
+};
+
+static const struct rp_vertex_layout default_layout = {
+	.attrs = {
+		[RP_ATTR_POSITION] = { RP_FORMAT_F32, 0, RP_VERTEX_STRIDE * sizeof(float) },
+		[RP_ATTR_COLOR] = { RP_FORMAT_F32, 3 * sizeof(float), RP_VERTEX_STRIDE * sizeof(float) }
+	}
+};
+
+static inline uint32_t attr_size(enum rp_attr attr, enum rp_format format)
+{
+	return (uint32_t)attr_component_counts[attr] * format_sizes[format];
+}
+
+static inline uint32_t attr_stride(const struct rp_vertex_layout *layout, enum rp_attr attr)
+{
+	const struct rp_attr_layout *attr_layout = &layout->attrs[attr];
+	return attr_layout->stride ? attr_layout->stride : attr_size(attr, attr_layout->format);
+}
+
+static bool layout_is_default(const struct rp_vertex_layout *layout)
+{
+	for (int32_t attr = 0; attr < RP_ATTR_NUM; ++attr) {
+		const struct rp_attr_layout *a = &layout->attrs[attr];
+		const struct rp_attr_layout *b = &default_layout.attrs[attr];
+		if (a->format != b->format) return false;
+		if (a->format == RP_FORMAT_NONE) continue;
+		if (a->offset != b->offset || attr_stride(layout, attr) != b->stride) return false;
+	}
+	return true;
+}
+
+// round to nearest even, overflow goes to infinity
+static uint16_t f32_to_f16(float value)
+{
+	union { float f; uint32_t u; } bits = { value };
+	const uint32_t sign = (bits.u >> 16) & 0x8000u;
+	const uint32_t exponent = (bits.u >> 23) & 0xffu;
+	uint32_t mantissa = bits.u & 0x7fffffu;
+
+	if (exponent == 0xffu) return (uint16_t)(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+	const int32_t half_exponent = (int32_t)exponent - 127 + 15;
+	if (half_exponent >= 0x1f) return (uint16_t)(sign | 0x7c00u);
+	if (half_exponent <= 0) {
+		if (half_exponent < -10) return (uint16_t)sign;
+		mantissa |= 0x800000u;
+		const uint32_t shift = (uint32_t)(14 - half_exponent);
+		uint32_t half = mantissa >> shift;
+		const uint32_t rest = mantissa & ((1u << shift) - 1u);
+		const uint32_t halfway = 1u << (shift - 1u);
+		if (rest > halfway || (rest == halfway && (half & 1u))) ++half;
+		return (uint16_t)(sign | half);
+	}
+	uint32_t half = sign | ((uint32_t)half_exponent << 10) | (mantissa >> 13);
+	const uint32_t rest = mantissa & 0x1fffu;
+	// a carry out of the mantissa correctly bumps the exponent
+	if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) ++half;
+	return (uint16_t)half;
+}
+
+static inline float clampf(float value, float lo, float hi)
+{
+	return value < lo ? lo : (value > hi ? hi : value);
+}
+
+static void write_attr(uint8_t *dst, enum rp_format format, const float *values, int32_t component_count)
+{
+	for (int32_t i = 0; i < component_count; ++i) {
+		switch (format) {
+		case RP_FORMAT_F32:
+			memcpy(dst + i * 4, &values[i], 4);
+			break;
+		case RP_FORMAT_F16: {
+			uint16_t half = f32_to_f16(values[i]);
+			memcpy(dst + i * 2, &half, 2);
+			break;
+		}
+		case RP_FORMAT_SNORM16: {
+			float scaled = clampf(values[i], -1.0f, 1.0f) * 32767.0f;
+			int16_t snorm = (int16_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+			memcpy(dst + i * 2, &snorm, 2);
+			break;
+		}
+		case RP_FORMAT_UNORM8:
+			dst[i] = (uint8_t)(clampf(values[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+			break;
+		default:
+			return;
+		}
+	}
+}
+
+struct vertex_attrs {
+	float values[RP_ATTR_NUM][4];
+};
+
+static void write_layout_vertex(uint8_t *vertices, const struct rp_vertex_layout *layout, int32_t vertex_idx,
+	const struct vertex_attrs *attrs)
+{
+	for (int32_t attr = 0; attr < RP_ATTR_NUM; ++attr) {
+		const struct rp_attr_layout *attr_layout = &layout->attrs[attr];
+		if (attr_layout->format == RP_FORMAT_NONE) continue;
+		uint8_t *dst = vertices + attr_layout->offset + (size_t)vertex_idx * attr_stride(layout, attr);
+		write_attr(dst, attr_layout->format, attrs->values[attr], attr_component_counts[attr]);
+	}
+}
+
+static void set_vertex_attrs(struct vertex_attrs *attrs, float x, float y, float z, float nx, float ny, float nz,
+	float u, float v, const float *color, float facet_id, float back)
+{
+	*attrs = (struct vertex_attrs){
+		.values = {
+			[RP_ATTR_POSITION] = { x, y, z },
+			[RP_ATTR_NORMAL] = { nx, ny, nz },
+			[RP_ATTR_UV] = { u, v },
+			[RP_ATTR_COLOR] = { color[0], color[1], color[2], 1.0f },
+			[RP_ATTR_FACET_ID] = { facet_id },
+			[RP_ATTR_BACK] = { back }
+		}
+	};
+}
+
+// for_ring_runs for a mesh, straight from the unit table when there is one
+static void mesh_ring_runs(const struct mesh_params *mesh, sincos_kernel sincos, int32_t begin, int32_t end,
+	ring_run_fn fn, void *ctx)
+{
+	if (!mesh->table) {
+		for_ring_runs(sincos, mesh->facet_count, begin, end, fn, ctx);
+		return;
+	}
+	fn(ctx, begin, end, mesh->table->sin + begin, mesh->table->cos + begin);
+}
+
+// the generic path: the unit ring comes in runs from the active sincos kernel (so positions match the default
+// layout bit for bit), then every enabled attribute of the four ring vertices goes through its format
+struct layout_run_ctx {
+	uint8_t *vertices;
+	const struct mesh_params *mesh;
+};
+
+// the attributes of ring's vertex of facet_idx, from the facet's unit circle position
+static void ring_vertex_attrs(struct vertex_attrs *attrs, const struct mesh_params *mesh, int32_t ring,
+	int32_t facet_idx, float sn, float cs)
+{
+	const float x = sn * mesh->facet_radius;
+	const float y = cs * mesh->facet_radius;
+	const float back = ring < 2 ? 0.0f : 1.0f;
+	const float z = ring < 2 ? 0.0f : -mesh->extrusion_depth;
+	const float *color = mesh->ring_colors[ring];
+	if (ring % 2 == 0) {
+		// caps map the unit disc onto [0, 1]^2
+		const float cap_u = 0.5f + 0.5f * sn;
+		const float cap_v = 0.5f + 0.5f * cs;
+		set_vertex_attrs(attrs, x, y, z, 0.0f, 0.0f, ring == 0 ? 1.0f : -1.0f, cap_u, cap_v, color, (float)facet_idx,
+			back);
+	} else {
+		// edges wrap u around the prism (the last quad's u runs back to 0)
+		const float edge_u = (float)facet_idx / (float)mesh->facet_count;
+		set_vertex_attrs(attrs, x, y, z, sn, cs, 0.0f, edge_u, ring == 1 ? 0.0f : 1.0f, color, (float)facet_idx, back);
+	}
+}
+
+// the center vertices belong to every cap triangle, so they carry facet id -1
+static void center_vertex_attrs(struct vertex_attrs *attrs, const struct mesh_params *mesh, int32_t center)
+{
+	if (center == 0) {
+		set_vertex_attrs(attrs, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.5f, 0.5f, mesh->ring_colors[0], -1.0f, 0.0f);
+	} else {
+		set_vertex_attrs(attrs, 0.0f, 0.0f, -mesh->extrusion_depth, 0.0f, 0.0f, -1.0f, 0.5f, 0.5f,
+			mesh->ring_colors[2], -1.0f, 1.0f);
+	}
+}
+
+static void layout_run(void *ctx, int32_t begin, int32_t end, const float *s, const float *c)
+{
+	const struct layout_run_ctx *run = ctx;
+	const struct rp_vertex_layout *layout = run->mesh->layout;
+	const int32_t facet_count = run->mesh->facet_count;
+
+	struct vertex_attrs attrs;
+	for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			ring_vertex_attrs(&attrs, run->mesh, ring, facet_idx, s[facet_idx - begin], c[facet_idx - begin]);
+			write_layout_vertex(run->vertices, layout, ring * facet_count + facet_idx, &attrs);
+		}
+	}
+}
+
+static void gen_layout_vertices(uint8_t *vertices, const struct mesh_params *mesh, int32_t begin, int32_t end)
+{
+	const struct rp_vertex_layout *layout = mesh->layout;
+	const int32_t facet_count = mesh->facet_count;
+
+	struct layout_run_ctx run = { .vertices = vertices, .mesh = mesh };
+	mesh_ring_runs(mesh, precision_fns(mesh->precision).sincos, begin, end, layout_run, &run);
+
+	if (begin == 0) {
+		struct vertex_attrs attrs;
+		for (int32_t center = 0; center < 2; ++center) {
+			center_vertex_attrs(&attrs, mesh, center);
+			write_layout_vertex(vertices, layout, facet_count * 4 + center, &attrs);
+		}
+	}
+}
+
+// structure of arrays output: each run of the unit circle is scaled into the first ring's x/y streams and copied
+// into the other three while it is still in l1. z and color are constant per ring and are filled without touching
+// the trig at all.
+static void write_soa_positions(const struct rp_soa *soa, int32_t facet_count, float facet_radius, int32_t begin,
+	int32_t end, const float *s, const float *c)
+{
+	float *x = soa->x + begin;
+	float *y = soa->y + begin;
+	for (int32_t i = 0; i < end - begin; ++i) {
+		x[i] = s[i] * facet_radius;
+		y[i] = c[i] * facet_radius;
+	}
+	const size_t run_bytes = (size_t)(end - begin) * sizeof(float);
+	for (int32_t ring = 1; ring < RP_RING_COUNT; ++ring) {
+		memcpy(x + (size_t)ring * facet_count, x, run_bytes);
+		memcpy(y + (size_t)ring * facet_count, y, run_bytes);
+	}
+}
+
+static void soa_run(void *ctx, int32_t begin, int32_t end, const float *s, const float *c)
+{
+	const struct mesh_params *mesh = ctx;
+	write_soa_positions(mesh->soa, mesh->facet_count, mesh->facet_radius, begin, end, s, c);
+}
+
+static void gen_soa_vertices(const struct rp_soa *soa, const struct mesh_params *mesh, int32_t begin, int32_t end)
+{
+	const int32_t facet_count = mesh->facet_count;
+	const float ring_z[RP_RING_COUNT] = { 0.0f, 0.0f, -mesh->extrusion_depth, -mesh->extrusion_depth };
+
+	mesh_ring_runs(mesh, precision_fns(mesh->precision).sincos, begin, end, soa_run, (void *)mesh);
+
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		float *z = soa->z + (size_t)ring * facet_count;
+		for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+			z[facet_idx] = ring_z[ring];
+		}
+		if (soa->colors) {
+			const float *color = mesh->ring_colors[ring];
+			float *colors = soa->colors + (size_t)ring * facet_count * 4;
+			for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+				colors[facet_idx * 4 + 0] = color[0];
+				colors[facet_idx * 4 + 1] = color[1];
+				colors[facet_idx * 4 + 2] = color[2];
+				colors[facet_idx * 4 + 3] = 1.0f;
+			}
+		}
+	}
+
+	if (begin == 0) {
+		const int32_t center_vertices[2] = { facet_count * 4, facet_count * 4 + 1 };
+		const float center_z[2] = { 0.0f, -mesh->extrusion_depth };
+		const float *center_colors[2] = { mesh->ring_colors[0], mesh->ring_colors[2] };
+		for (int32_t i = 0; i < 2; ++i) {
+			const int32_t vertex = center_vertices[i];
+			soa->x[vertex] = 0.0f;
+			soa->y[vertex] = 0.0f;
+			soa->z[vertex] = center_z[i];
+			if (soa->colors) {
+				soa->colors[vertex * 4 + 0] = center_colors[i][0];
+				soa->colors[vertex * 4 + 1] = center_colors[i][1];
+				soa->colors[vertex * 4 + 2] = center_colors[i][2];
+				soa->colors[vertex * 4 + 3] = 1.0f;
+			}
+		}
+	}
+}
+
+struct ring_run_ctx {
+	struct ring_params params;
+	ring_kernel ring;
+};
+
+static void ring_run(void *ctx, int32_t begin, int32_t end, const float *s, const float *c)
+{
+	struct ring_run_ctx *run = ctx;
+	run->params.unit_sin = s;
+	run->params.unit_cos = c;
+	run->ring(&run->params, begin, end);
+}
+
+// gen_vertices once the unit table, if any, is resolved
+static void emit_vertices(void *vertex_data, const struct mesh_params *mesh, int32_t begin, int32_t end)
+{
+	if (mesh->soa) {
+		gen_soa_vertices(mesh->soa, mesh, begin, end);
+		return;
+	}
+	if (mesh->layout && !layout_is_default(mesh->layout)) {
+		gen_layout_vertices(vertex_data, mesh, begin, end);
+		return;
+	}
+
+	float *vertices = vertex_data;
+	const int32_t facet_count = mesh->facet_count;
+	const float extrusion_depth = mesh->extrusion_depth;
+
+	// vertex layout: front facet ring, front edge ring, back facet ring, back edge ring, front center, back center
+	const int32_t front_center_vertex = facet_count * 4;
+	const int32_t back_center_vertex = facet_count * 4 + 1;
+
+	// all four rings share the same unit circle position, so the kernels compute each sin/cos pair once per
+	// facet and fan it out to the four rings
+	const struct kernel_fns fns = precision_fns(mesh->precision);
+	struct ring_params params = {
+		.vertices = vertices,
+		.facet_count = facet_count,
+		.facet_rad = RP_PI32 * 2.0f / (float)facet_count,
+		.facet_radius = mesh->facet_radius,
+		.ring_z = { 0.0f, 0.0f, -extrusion_depth, -extrusion_depth },
+		.ring_colors = mesh->ring_colors
+	};
+	if (mesh->table) {
+		params.unit_sin = mesh->table->sin + begin;
+		params.unit_cos = mesh->table->cos + begin;
+		fns.ring(&params, begin, end);
+	} else if (!ring_symmetric(facet_count) && mesh->precision != RP_PRECISION_COARSE) {
+		// no symmetry to exploit, the kernel evaluates every facet inline
+		fns.ring(&params, begin, end);
+	} else if (end - begin <= RP_SYMMETRY_CHUNK) {
+		// small ranges gather their runs first, so the kernel stores whole vectors instead of many short runs
+		float s[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
+		float c[RP_SYMMETRY_CHUNK + RP_UNIT_PADDING];
+		struct unit_fill fill = { .begin = begin, .s = s, .c = c };
+		for_ring_runs(fns.sincos, facet_count, begin, end, NULL, &fill);
+		params.unit_sin = s;
+		params.unit_cos = c;
+		fns.ring(&params, begin, end);
+	} else {
+		struct ring_run_ctx run = { .params = params, .ring = fns.ring };
+		for_ring_runs(fns.sincos, facet_count, begin, end, ring_run, &run);
+	}
+
+	if (begin == 0) {
+		// front center vertex
+		set_vertex(&vertices[front_center_vertex * RP_VERTEX_STRIDE], 0.0f, 0.0f, 0.0f, mesh->ring_colors[0]);
+
+		// back center vertex
+		set_vertex(&vertices[back_center_vertex * RP_VERTEX_STRIDE], 0.0f, 0.0f, -extrusion_depth,
+			mesh->ring_colors[2]);
+	}
+}
+
+// writes the ring vertices of facets [begin, end); the center vertices go with the range that starts at facet 0
+static void gen_vertices(void *vertex_data, const struct mesh_params *mesh, int32_t begin, int32_t end)
+{
+	if (!mesh->table_cache) {
+		emit_vertices(vertex_data, mesh, begin, end);
+		return;
+	}
+	struct facet_table *table = table_cache_acquire_unit_circle(mesh->table_cache, mesh->facet_count,
+		precision_fns(mesh->precision).sincos);
+	struct mesh_params cached = *mesh;
+	cached.table = table;
+	emit_vertices(vertex_data, &cached, begin, end);
+	table_cache_release(mesh->table_cache, table);
+}
+
+// index sections. an index block is a sequence of sections written in order: per-facet sections hold the same
+// number of indices for every facet, fixed sections (the strip joins and the side wall's closing pair) a few indices
+// once. whole meshes, facet ranges and streamed windows all go through write_index_section.
+//
+// triangle lists: front cap fan, back cap fan, then two side wall triangles per facet.
+//
+// strips: the side wall is one closed strip (front edge i, back edge i, ..., wrapping back to facet 0) and each cap
+// is a zig-zag strip over its ring (0, 1, n-1, 2, n-2, ...; reversed for the back cap) that leaves the center vertex
+// unused. the strips go front cap, back cap, side wall, separated by a primitive restart index or by a degenerate
+// join of 2 or 3 indices that keeps the next strip starting on an even position, so every triangle keeps the
+// winding of the triangle list.
+enum index_section_kind {
+	SECTION_FRONT_FAN,   // 3 per facet
+	SECTION_BACK_FAN,    // 3 per facet
+	SECTION_SIDE_QUADS,  // 6 per facet
+	SECTION_FRONT_STRIP, // 1 per facet
+	SECTION_BACK_STRIP,  // 1 per facet
+	SECTION_SIDE_STRIP,  // 2 per facet
+	SECTION_SIDE_CLOSE,  // 2, written with the last facet
+	SECTION_JOIN         // 1 restart index or a 2-3 index degenerate join, written with facet 0
+};
+
+#define RP_MAX_INDEX_SECTIONS 6
+#define RP_MAX_SECTION_UNIT 6
+
+struct index_section {
+	enum index_section_kind kind;
+	size_t offset;          // element of the block the section starts at
+	int32_t unit_count;     // facet_count for per-facet sections, 1 for fixed ones
+	int32_t unit_elements;  // indices per unit
+	int32_t join;           // SECTION_JOIN: 0 after the front cap, 1 after the back cap
+};
+
+struct index_sections {
+	struct index_section sections[RP_MAX_INDEX_SECTIONS];
+	uint32_t count;
+	size_t element_count;
+};
+
+static void index_sections(int32_t facet_count, enum rp_topology topology, struct index_sections *out)
+{
+	out->count = 0;
+	out->element_count = 0;
+	const bool strip = topology != RP_TOPOLOGY_TRIANGLES;
+	const enum index_section_kind kinds[2][RP_MAX_INDEX_SECTIONS] = {
+		{ SECTION_FRONT_FAN, SECTION_BACK_FAN, SECTION_SIDE_QUADS },
+		{ SECTION_FRONT_STRIP, SECTION_JOIN, SECTION_BACK_STRIP, SECTION_JOIN, SECTION_SIDE_STRIP, SECTION_SIDE_CLOSE }
+	};
+	const uint32_t count = strip ? 6 : 3;
+	int32_t join = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		struct index_section *section = &out->sections[out->count++];
+		*section = (struct index_section){ .kind = kinds[strip][i], .offset = out->element_count, .unit_count = 1 };
+		switch (section->kind) {
+		case SECTION_FRONT_FAN:
+		case SECTION_BACK_FAN:
+			section->unit_count = facet_count;
+			section->unit_elements = 3;
+			break;
+		case SECTION_SIDE_QUADS:
+			section->unit_count = facet_count;
+			section->unit_elements = 6;
+			break;
+		case SECTION_FRONT_STRIP:
+		case SECTION_BACK_STRIP:
+			section->unit_count = facet_count;
+			section->unit_elements = 1;
+			break;
+		case SECTION_SIDE_STRIP:
+			section->unit_count = facet_count;
+			section->unit_elements = 2;
+			break;
+		case SECTION_SIDE_CLOSE:
+			section->unit_elements = 2;
+			break;
+		case SECTION_JOIN:
+			section->join = join++;
+			// a degenerate join pads to an even position
+			section->unit_elements = topology == RP_TOPOLOGY_STRIP_RESTART ? 1 : (out->element_count % 2 ? 3 : 2);
+			break;
+		}
+		out->element_count += (size_t)section->unit_count * (size_t)section->unit_elements;
+	}
+}
+
+static inline uint32_t front_strip_vertex(int32_t facet_count, int32_t position)
+{
+	if (position == 0) return 0;
+	return (uint32_t)((position & 1) ? (position + 1) / 2 : facet_count - position / 2);
+}
+
+static inline uint32_t back_strip_vertex(int32_t facet_count, int32_t position)
+{
+	if (position == 0) return 0;
+	return (uint32_t)((position & 1) ? facet_count - (position + 1) / 2 : position / 2);
+}
+
+// writes units [begin, end) of a section, the first at dst. base_vertex is added to every index, so meshes packed
+// behind each other can share one vertex block. one body, instantiated for 16 and 32 bit indices.
+#define RP_DEFINE_WRITE_INDEX_SECTION(name, index_t, restart_index) \
+static void name(index_t *dst, const struct index_section *section, int32_t facet_count, uint32_t base_vertex, \
+	int32_t begin, int32_t end) \
+{ \
+	const uint32_t front_facet_start_vertex = base_vertex; \
+	const uint32_t front_edge_start_vertex = base_vertex + (uint32_t)facet_count; \
+	const uint32_t back_facet_start_vertex = base_vertex + (uint32_t)facet_count * 2; \
+	const uint32_t back_edge_start_vertex = base_vertex + (uint32_t)facet_count * 3; \
+	const uint32_t front_center_vertex = base_vertex + (uint32_t)facet_count * 4; \
+	const uint32_t back_center_vertex = base_vertex + (uint32_t)facet_count * 4 + 1; \
+ \
+	switch (section->kind) { \
+	case SECTION_FRONT_FAN: \
+		for (int32_t i = begin; i < end; ++i, dst += 3) { \
+			const uint32_t next = (uint32_t)((i + 1) % facet_count); \
+			dst[0] = (index_t)front_center_vertex; \
+			dst[1] = (index_t)(front_facet_start_vertex + (uint32_t)i); \
+			dst[2] = (index_t)(front_facet_start_vertex + next); \
+		} \
+		break; \
+	case SECTION_BACK_FAN: \
+		for (int32_t i = begin; i < end; ++i, dst += 3) { \
+			const uint32_t next = (uint32_t)((i + 1) % facet_count); \
+			dst[0] = (index_t)back_center_vertex; \
+			dst[1] = (index_t)(back_facet_start_vertex + next); \
+			dst[2] = (index_t)(back_facet_start_vertex + (uint32_t)i); \
+		} \
+		break; \
+	case SECTION_SIDE_QUADS: \
+		for (int32_t i = begin; i < end; ++i, dst += 6) { \
+			const uint32_t next = (uint32_t)((i + 1) % facet_count); \
+			const index_t start_vertex = (index_t)(front_edge_start_vertex + (uint32_t)i); \
+			const index_t end_vertex = (index_t)(back_edge_start_vertex + next); \
+			dst[0] = start_vertex; \
+			dst[1] = (index_t)(back_edge_start_vertex + (uint32_t)i); \
+			dst[2] = end_vertex; \
+			dst[3] = end_vertex; \
+			dst[4] = (index_t)(front_edge_start_vertex + next); \
+			dst[5] = start_vertex; \
+		} \
+		break; \
+	case SECTION_FRONT_STRIP: \
+		for (int32_t i = begin; i < end; ++i) { \
+			*dst++ = (index_t)(front_facet_start_vertex + front_strip_vertex(facet_count, i)); \
+		} \
+		break; \
+	case SECTION_BACK_STRIP: \
+		for (int32_t i = begin; i < end; ++i) { \
+			*dst++ = (index_t)(back_facet_start_vertex + back_strip_vertex(facet_count, i)); \
+		} \
+		break; \
+	case SECTION_SIDE_STRIP: \
+		for (int32_t i = begin; i < end; ++i, dst += 2) { \
+			dst[0] = (index_t)(front_edge_start_vertex + (uint32_t)i); \
+			dst[1] = (index_t)(back_edge_start_vertex + (uint32_t)i); \
+		} \
+		break; \
+	case SECTION_SIDE_CLOSE: \
+		dst[0] = (index_t)front_edge_start_vertex; \
+		dst[1] = (index_t)back_edge_start_vertex; \
+		break; \
+	case SECTION_JOIN: { \
+		/* a degenerate join repeats the last index of one strip and the first of the next */ \
+		const index_t join_values[2][2] = { \
+			{ (index_t)(front_facet_start_vertex + front_strip_vertex(facet_count, facet_count - 1)), \
+				(index_t)back_facet_start_vertex }, \
+			{ (index_t)(back_facet_start_vertex + back_strip_vertex(facet_count, facet_count - 1)), \
+				(index_t)front_edge_start_vertex } \
+		}; \
+		if (section->unit_elements == 1) { \
+			dst[0] = (index_t)(restart_index); \
+			break; \
+		} \
+		dst[0] = join_values[section->join][0]; \
+		dst[1] = join_values[section->join][1]; \
+		if (section->unit_elements == 3) dst[2] = join_values[section->join][1]; \
+		break; \
+	} \
+	} \
+}
+
+RP_DEFINE_WRITE_INDEX_SECTION(write_index_section_u16, uint16_t, UINT16_MAX)
+RP_DEFINE_WRITE_INDEX_SECTION(write_index_section_u32, uint32_t, UINT32_MAX)
+
+static inline void write_index_units(void *dst, enum rp_index_type index_type, const struct index_section *section,
+	int32_t facet_count, uint32_t base_vertex, int32_t begin, int32_t end)
+{
+	if (index_type == RP_INDEX_TYPE_UINT32) {
+		write_index_section_u32(dst, section, facet_count, base_vertex, begin, end);
+	} else {
+		write_index_section_u16(dst, section, facet_count, base_vertex, begin, end);
+	}
+}
+
+// units [begin, end) of a section into an index block, exactly one of the two pointers is set
+static inline void write_index_section(uint16_t *indices, uint32_t *indices32, const struct index_section *section,
+	int32_t facet_count, uint32_t base_vertex, int32_t begin, int32_t end)
+{
+	const size_t first = section->offset + (size_t)begin * (size_t)section->unit_elements;
+	if (indices32) {
+		write_index_units(indices32 + first, RP_INDEX_TYPE_UINT32, section, facet_count, base_vertex, begin, end);
+	} else {
+		write_index_units(indices + first, RP_INDEX_TYPE_UINT16, section, facet_count, base_vertex, begin, end);
+	}
+}
+
+// writes the indices of facets [begin, end) in every section: facet i owns its units of the per-facet sections,
+// facet 0 the joins and the last facet the side wall's closing pair
+static void gen_indices(uint16_t *indices, uint32_t *indices32, enum rp_topology topology, int32_t facet_count,
+	uint32_t base_vertex, int32_t begin, int32_t end)
+{
+	struct index_sections sections;
+	index_sections(facet_count, topology, &sections);
+	for (uint32_t i = 0; i < sections.count; ++i) {
+		const struct index_section *section = &sections.sections[i];
+		if (section->kind == SECTION_SIDE_CLOSE) {
+			if (end == facet_count) write_index_section(indices, indices32, section, facet_count, base_vertex, 0, 1);
+		} else if (section->kind == SECTION_JOIN) {
+			if (begin == 0) write_index_section(indices, indices32, section, facet_count, base_vertex, 0, 1);
+		} else {
+			write_index_section(indices, indices32, section, facet_count, base_vertex, begin, end);
+		}
+	}
+}
+
+size_t rp_index_count(int32_t facet_count, enum rp_topology topology)
+{
+	if (topology == RP_TOPOLOGY_TRIANGLES) return (size_t)facet_count * 4 * RP_INDEX_STRIDE;
+	struct index_sections sections;
+	index_sections(facet_count, topology, &sections);
+	return sections.element_count;
+}
+
+enum rp_index_type rp_index_type(int32_t facet_count)
+{
+	// the largest index is the back center vertex, facet_count * 4 + 1
+	return (int64_t)facet_count * 4 + 1 <= UINT16_MAX ? RP_INDEX_TYPE_UINT16 : RP_INDEX_TYPE_UINT32;
+}
+
+size_t rp_index_type_size(enum rp_index_type index_type)
+{
+	return index_type == RP_INDEX_TYPE_UINT32 ? sizeof(uint32_t) : sizeof(uint16_t);
+}
+
+static inline void assert_desc(int32_t facet_count, float facet_radius, float extrusion_depth)
+{
+	assert(facet_count >= 3);
+	assert(facet_radius > 0.0f);
+	assert(extrusion_depth > 0.0f);
+	(void)facet_count;
+	(void)facet_radius;
+	(void)extrusion_depth;
+}
+
+static inline const float (*ring_colors_or_default(const float *ring_colors))[3]
+{
+	return ring_colors ? (const float (*)[3])ring_colors : default_ring_colors;
+}
+
+static inline struct mesh_params mesh_from_data(const struct rp_data *data)
+{
+	return (struct mesh_params){
+		.facet_count = data->facet_count,
+		.facet_radius = data->facet_radius,
+		.extrusion_depth = data->extrusion_depth,
+		.layout = data->layout,
+		.soa = data->soa,
+		.ring_colors = ring_colors_or_default(data->ring_colors),
+		.precision = data->precision,
+		.table_cache = data->table_cache
+	};
+}
+
+size_t rp_vertex_buffer_size(int32_t facet_count, const struct rp_vertex_layout *layout)
+{
+	const size_t vertex_count = (size_t)facet_count * 4 + 2;
+	if (!layout) layout = &default_layout;
+
+	size_t size = 0;
+	for (int32_t attr = 0; attr < RP_ATTR_NUM; ++attr) {
+		const struct rp_attr_layout *attr_layout = &layout->attrs[attr];
+		if (attr_layout->format == RP_FORMAT_NONE) continue;
+		size_t attr_end = attr_layout->offset + (vertex_count - 1) * attr_stride(layout, attr) +
+			attr_size(attr, attr_layout->format);
+		if (attr_end > size) size = attr_end;
+	}
+	return size;
+}
+
+struct rp_plan rp_plan(const struct rp_plan_desc *desc)
+{
+	assert(desc);
+	assert(desc->facet_count >= 3);
+	assert(!desc->soa_colors || desc->soa);
+
+	const int32_t facet_count = desc->facet_count;
+	struct rp_plan plan = {
+		.alignment = RP_PLAN_ALIGNMENT,
+		.vertex_count = (uint32_t)facet_count * 4 + 2,
+		.index_type = rp_index_type(facet_count)
+	};
+	if (desc->soa) {
+		const size_t stream_bytes = (size_t)plan.vertex_count * sizeof(float);
+		plan.sizes[RP_STREAM_SOA_X] = stream_bytes;
+		plan.sizes[RP_STREAM_SOA_Y] = stream_bytes;
+		plan.sizes[RP_STREAM_SOA_Z] = stream_bytes;
+		plan.sizes[RP_STREAM_SOA_COLORS] = desc->soa_colors ? stream_bytes * 4 : 0;
+	} else {
+		plan.sizes[RP_STREAM_VERTICES] = rp_vertex_buffer_size(facet_count, desc->layout);
+	}
+	if (!desc->no_indices) {
+		plan.index_count = rp_index_count(facet_count, desc->topology);
+		plan.sizes[RP_STREAM_INDICES] = plan.index_count * rp_index_type_size(plan.index_type);
+	}
+
+	for (int32_t stream = 0; stream < RP_STREAM_NUM; ++stream) {
+		if (plan.sizes[stream] == 0) continue;
+		plan.offsets[stream] = plan.total_bytes;
+		plan.total_bytes += align_size(plan.sizes[stream], RP_PLAN_ALIGNMENT);
+	}
+	return plan;
+}
+
+void rp_plan_bind(const struct rp_plan *plan, void *block, struct rp_data *data, struct rp_soa *soa)
+{
+	assert(plan && block && data);
+	assert(((uintptr_t)block & (plan->alignment - 1)) == 0);
+
+	uint8_t *bytes = block;
+	void *streams[RP_STREAM_NUM] = { 0 };
+	for (int32_t stream = 0; stream < RP_STREAM_NUM; ++stream) {
+		if (plan->sizes[stream] != 0) streams[stream] = bytes + plan->offsets[stream];
+	}
+
+	data->vertices = streams[RP_STREAM_VERTICES];
+	data->indices = plan->index_type == RP_INDEX_TYPE_UINT16 ? streams[RP_STREAM_INDICES] : NULL;
+	data->indices32 = plan->index_type == RP_INDEX_TYPE_UINT32 ? streams[RP_STREAM_INDICES] : NULL;
+	data->soa = NULL;
+	if (plan->sizes[RP_STREAM_SOA_X] != 0) {
+		assert(soa);
+		*soa = (struct rp_soa){
+			.x = streams[RP_STREAM_SOA_X],
+			.y = streams[RP_STREAM_SOA_Y],
+			.z = streams[RP_STREAM_SOA_Z],
+			.colors = streams[RP_STREAM_SOA_COLORS]
+		};
+		data->soa = soa;
+	}
+}
+
+static inline void assert_vertex_outputs(const struct rp_data *data)
+{
+	assert(data->soa ? (data->soa->x && data->soa->y && data->soa->z) : data->vertices != NULL);
+	assert(data->precision >= RP_PRECISION_FAST && data->precision <= RP_PRECISION_COARSE);
+	(void)data;
+}
+
+static inline void assert_index_outputs(const struct rp_data *data)
+{
+	assert((data->indices != NULL) != (data->indices32 != NULL));
+	// 16 bit indices would silently wrap
+	assert(data->indices32 || rp_index_type(data->facet_count) == RP_INDEX_TYPE_UINT16);
+	assert(data->topology >= RP_TOPOLOGY_TRIANGLES && data->topology <= RP_TOPOLOGY_STRIP_DEGENERATE);
+	(void)data;
+}
+
+static inline void assert_outputs(const struct rp_data *data)
+{
+	assert_vertex_outputs(data);
+	assert_index_outputs(data);
+}
+
+static void build_indices(struct facet_table *table)
+{
+	void *indices = table + 1;
+	gen_indices(table->index_type == RP_INDEX_TYPE_UINT16 ? indices : NULL,
+		table->index_type == RP_INDEX_TYPE_UINT32 ? indices : NULL, table->topology, table->facet_count, 0, 0,
+		table->facet_count);
+}
+
+const void *rp_table_cache_acquire_indices(struct rp_table_cache *cache, int32_t facet_count,
+	enum rp_topology topology, enum rp_index_type index_type)
+{
+	assert(facet_count >= 3);
+	assert(topology >= RP_TOPOLOGY_TRIANGLES && topology <= RP_TOPOLOGY_STRIP_DEGENERATE);
+	assert(index_type == RP_INDEX_TYPE_UINT32 || rp_index_type(facet_count) == RP_INDEX_TYPE_UINT16);
+
+	const struct facet_table key = {
+		.kind = TABLE_INDICES,
+		.facet_count = facet_count,
+		.topology = topology,
+		.index_type = index_type
+	};
+	const size_t data_bytes = rp_index_count(facet_count, topology) * rp_index_type_size(index_type);
+	struct facet_table *table = table_cache_acquire(cache, &key, data_bytes, build_indices);
+	return table ? table + 1 : NULL;
+}
+
+void rp_table_cache_release_indices(struct rp_table_cache *cache, const void *indices)
+{
+	if (!indices) return;
+	table_cache_release(cache, (struct facet_table *)indices - 1);
+}
+
+// the whole index block of a mesh, copied from the cached pattern when there is one
+static void gen_mesh_indices(const struct rp_data *data)
+{
+	if (data->table_cache) {
+		const enum rp_index_type index_type = data->indices32 ? RP_INDEX_TYPE_UINT32 : RP_INDEX_TYPE_UINT16;
+		const void *pattern = rp_table_cache_acquire_indices(data->table_cache, data->facet_count, data->topology,
+			index_type);
+		if (pattern) {
+			void *indices = data->indices32 ? (void *)data->indices32 : (void *)data->indices;
+			memcpy(indices, pattern,
+				rp_index_count(data->facet_count, data->topology) * rp_index_type_size(index_type));
+			rp_table_cache_release_indices(data->table_cache, pattern);
+			return;
+		}
+	}
+	gen_indices(data->indices, data->indices32, data->topology, data->facet_count, 0, 0, data->facet_count);
+}
+
+void rp_gen(struct rp_data *data)
+{
+	assert_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+
+	const struct mesh_params mesh = mesh_from_data(data);
+	gen_vertices(data->vertices, &mesh, 0, data->facet_count);
+	gen_mesh_indices(data);
+
+	return;
+}
+
+void rp_gen_vertices(struct rp_data *data)
+{
+	assert_vertex_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+
+	const struct mesh_params mesh = mesh_from_data(data);
+	gen_vertices(data->vertices, &mesh, 0, data->facet_count);
+}
+
+void rp_gen_indices(struct rp_data *data)
+{
+	assert_index_outputs(data);
+	assert(data->facet_count >= 3);
+
+	gen_mesh_indices(data);
+}
+
+// in-place updates
+//
+// an update rewrites some components of one attribute for runs of vertices and reports the bytes it touched.
+// strided writes are reported as one range from the first to the last written byte, and ranges of one stream
+// closer than RP_DIRTY_MERGE_GAP are merged, so the list stays short enough to upload range by range.
+
+#define RP_DIRTY_MERGE_GAP 64
+
+static void add_dirty_range(struct rp_dirty_ranges *dirty, enum rp_stream stream, size_t offset, size_t size)
+{
+	for (uint32_t i = dirty->count; i-- > 0;) {
+		struct rp_byte_range *range = &dirty->ranges[i];
+		if (range->stream != stream) continue;
+		const size_t range_end = range->offset + range->size;
+		// a full list folds the rest into the stream's last range
+		if (dirty->count == RP_MAX_DIRTY_RANGES || (offset >= range_end && offset - range_end <= RP_DIRTY_MERGE_GAP)) {
+			const size_t end = offset + size > range_end ? offset + size : range_end;
+			if (offset < range->offset) range->offset = offset;
+			range->size = end - range->offset;
+			return;
+		}
+		break;
+	}
+	assert(dirty->count < RP_MAX_DIRTY_RANGES);
+	dirty->ranges[dirty->count++] = (struct rp_byte_range){ .stream = stream, .offset = offset, .size = size };
+}
+
+// constant sized copies become plain stores
+static void store_strided(uint8_t *dst, size_t stride, int32_t count, const uint8_t *value, uint32_t size)
+{
+	switch (size) {
+	case 16:
+		for (int32_t i = 0; i < count; ++i) memcpy(dst + (size_t)i * stride, value, 16);
+		break;
+	case 8:
+		for (int32_t i = 0; i < count; ++i) memcpy(dst + (size_t)i * stride, value, 8);
+		break;
+	case 4:
+		for (int32_t i = 0; i < count; ++i) memcpy(dst + (size_t)i * stride, value, 4);
+		break;
+	case 2:
+		for (int32_t i = 0; i < count; ++i) memcpy(dst + (size_t)i * stride, value, 2);
+		break;
+	case 1:
+		for (int32_t i = 0; i < count; ++i) dst[(size_t)i * stride] = value[0];
+		break;
+	default:
+		for (int32_t i = 0; i < count; ++i) memcpy(dst + (size_t)i * stride, value, size);
+		break;
+	}
+}
+
+// writes the same component_count values, starting at first_component, to attr of vertices
+// [first_vertex, first_vertex + vertex_count)
+static void update_attr(const struct rp_data *data, enum rp_attr attr, int32_t first_component,
+	int32_t component_count, const float *values, int32_t first_vertex, int32_t vertex_count,
+	struct rp_dirty_ranges *dirty)
+{
+	if (data->soa) {
+		if (attr == RP_ATTR_POSITION) {
+			float *const streams[3] = { data->soa->x, data->soa->y, data->soa->z };
+			for (int32_t i = 0; i < component_count; ++i) {
+				float *stream = streams[first_component + i];
+				for (int32_t vertex = first_vertex; vertex < first_vertex + vertex_count; ++vertex) {
+					stream[vertex] = values[i];
+				}
+				add_dirty_range(dirty, (enum rp_stream)(RP_STREAM_SOA_X + first_component + i),
+					(size_t)first_vertex * sizeof(float), (size_t)vertex_count * sizeof(float));
+			}
+		} else if (attr == RP_ATTR_COLOR && data->soa->colors) {
+			float *colors = data->soa->colors + (size_t)first_vertex * 4 + first_component;
+			for (int32_t vertex = 0; vertex < vertex_count; ++vertex) {
+				memcpy(colors + (size_t)vertex * 4, values, (size_t)component_count * sizeof(float));
+			}
+			add_dirty_range(dirty, RP_STREAM_SOA_COLORS, ((size_t)first_vertex * 4 + first_component) * sizeof(float),
+				((size_t)(vertex_count - 1) * 4 + component_count) * sizeof(float));
+		}
+		return;
+	}
+
+	const struct rp_vertex_layout *layout = data->layout ? data->layout : &default_layout;
+	const struct rp_attr_layout *attr_layout = &layout->attrs[attr];
+	if (attr_layout->format == RP_FORMAT_NONE) return;
+
+	const uint32_t component_size = format_sizes[attr_layout->format];
+	const uint32_t size = component_size * (uint32_t)component_count;
+	const size_t stride = attr_stride(layout, attr);
+	uint8_t encoded[4 * sizeof(float)];
+	write_attr(encoded, attr_layout->format, values, component_count);
+
+	uint8_t *vertices = (uint8_t *)data->vertices;
+	const size_t offset = attr_layout->offset + (size_t)first_component * component_size +
+		(size_t)first_vertex * stride;
+	store_strided(vertices + offset, stride, vertex_count, encoded, size);
+	add_dirty_range(dirty, RP_STREAM_VERTICES, offset, (size_t)(vertex_count - 1) * stride + size);
+}
+
+// the x/y of every ring vertex, computed and written exactly like the generators do from runs of the unit circle
+struct position_run_ctx {
+	const struct rp_data *data;
+	const struct rp_vertex_layout *layout;
+};
+
+static void position_run(void *ctx, int32_t begin, int32_t end, const float *s, const float *c)
+{
+	const struct position_run_ctx *run = ctx;
+	const int32_t facet_count = run->data->facet_count;
+
+	if (run->data->soa) {
+		write_soa_positions(run->data->soa, facet_count, run->data->facet_radius, begin, end, s, c);
+		return;
+	}
+
+	const struct rp_attr_layout *attr_layout = &run->layout->attrs[RP_ATTR_POSITION];
+	const size_t stride = attr_stride(run->layout, RP_ATTR_POSITION);
+	const uint32_t size = 2 * format_sizes[attr_layout->format];
+	const float facet_radius = run->data->facet_radius;
+	uint8_t *positions = (uint8_t *)run->data->vertices + attr_layout->offset;
+	if (attr_layout->format == RP_FORMAT_F32) {
+		for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+			const float xy[2] = { s[facet_idx - begin] * facet_radius, c[facet_idx - begin] * facet_radius };
+			for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+				memcpy(positions + (size_t)(ring * facet_count + facet_idx) * stride, xy, sizeof(xy));
+			}
+		}
+		return;
+	}
+	for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+		const float xy[2] = { s[facet_idx - begin] * facet_radius, c[facet_idx - begin] * facet_radius };
+		uint8_t encoded[2 * sizeof(float)];
+		write_attr(encoded, attr_layout->format, xy, 2);
+		for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+			memcpy(positions + (size_t)(ring * facet_count + facet_idx) * stride, encoded, size);
+		}
+	}
+}
+
+void rp_update_depth(struct rp_data *data, struct rp_dirty_ranges *dirty)
+{
+	assert_vertex_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+	assert(dirty);
+
+	// the back facet and back edge rings, then the back center vertex
+	const int32_t facet_count = data->facet_count;
+	const float z = -data->extrusion_depth;
+	dirty->count = 0;
+	update_attr(data, RP_ATTR_POSITION, 2, 1, &z, facet_count * 2, facet_count * 2, dirty);
+	update_attr(data, RP_ATTR_POSITION, 2, 1, &z, facet_count * 4 + 1, 1, dirty);
+}
+
+void rp_update_radius(struct rp_data *data, struct rp_dirty_ranges *dirty)
+{
+	assert_vertex_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+	assert(dirty);
+
+	const int32_t facet_count = data->facet_count;
+	const struct rp_vertex_layout *layout = data->layout ? data->layout : &default_layout;
+	dirty->count = 0;
+	if (!data->soa && layout->attrs[RP_ATTR_POSITION].format == RP_FORMAT_NONE) return;
+
+	const sincos_kernel sincos = precision_fns(data->precision).sincos;
+	struct mesh_params mesh = mesh_from_data(data);
+	struct facet_table *table = NULL;
+	if (data->table_cache) {
+		table = table_cache_acquire_unit_circle(data->table_cache, facet_count, sincos);
+		mesh.table = table;
+	}
+	struct position_run_ctx run = { .data = data, .layout = layout };
+	mesh_ring_runs(&mesh, sincos, 0, facet_count, position_run, &run);
+	if (table) table_cache_release(data->table_cache, table);
+
+	// the center vertices stay at the origin
+	if (data->soa) {
+		add_dirty_range(dirty, RP_STREAM_SOA_X, 0, (size_t)facet_count * 4 * sizeof(float));
+		add_dirty_range(dirty, RP_STREAM_SOA_Y, 0, (size_t)facet_count * 4 * sizeof(float));
+	} else {
+		const struct rp_attr_layout *attr_layout = &layout->attrs[RP_ATTR_POSITION];
+		add_dirty_range(dirty, RP_STREAM_VERTICES, attr_layout->offset, (size_t)(facet_count * 4 - 1) *
+			attr_stride(layout, RP_ATTR_POSITION) + 2 * format_sizes[attr_layout->format]);
+	}
+}
+
+void rp_update_colors(struct rp_data *data, struct rp_dirty_ranges *dirty)
+{
+	assert_vertex_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+	assert(dirty);
+
+	const int32_t facet_count = data->facet_count;
+	const float (*ring_colors)[3] = ring_colors_or_default(data->ring_colors);
+	dirty->count = 0;
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		const float rgba[4] = { ring_colors[ring][0], ring_colors[ring][1], ring_colors[ring][2], 1.0f };
+		update_attr(data, RP_ATTR_COLOR, 0, 4, rgba, ring * facet_count, facet_count, dirty);
+	}
+	// the front center takes the front facet ring's color, the back center the back facet ring's
+	for (int32_t center = 0; center < 2; ++center) {
+		const float *color = ring_colors[center * 2];
+		const float rgba[4] = { color[0], color[1], color[2], 1.0f };
+		update_attr(data, RP_ATTR_COLOR, 0, 4, rgba, facet_count * 4 + center, 1, dirty);
+	}
+}
+
+void rp_gen_range(struct rp_data *data, int32_t facet_begin, int32_t facet_end)
+{
+	assert_outputs(data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+	assert(facet_begin >= 0 && facet_begin <= facet_end && facet_end <= data->facet_count);
+
+	const struct mesh_params mesh = mesh_from_data(data);
+	gen_vertices(data->vertices, &mesh, facet_begin, facet_end);
+	gen_indices(data->indices, data->indices32, data->topology, data->facet_count, 0, facet_begin, facet_end);
+}
+
+// streaming generation
+//
+// a vertex chunk is a range of whole vertices: each ring's part of it comes from the same sincos runs rp_gen_range
+// uses for those facets, so the values match bit for bit. an index chunk is a range of index elements: whole
+// section units are written in place, a unit cut by the chunk's ends goes through a small buffer.
+
+struct stream_run_ctx {
+	uint8_t *vertices; // where the vertex of first_facet goes
+	const struct mesh_params *mesh;
+	const struct rp_vertex_layout *layout; // NULL = the default layout
+	size_t stride;
+	int32_t ring;
+	int32_t first_facet;
+};
+
+static void stream_run(void *ctx, int32_t begin, int32_t end, const float *s, const float *c)
+{
+	const struct stream_run_ctx *run = ctx;
+	const struct mesh_params *mesh = run->mesh;
+
+	if (!run->layout) {
+		const float z = run->ring < 2 ? 0.0f : -mesh->extrusion_depth;
+		for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+			float *vertex = (float *)(run->vertices + (size_t)(facet_idx - run->first_facet) * run->stride);
+			set_vertex(vertex, s[facet_idx - begin] * mesh->facet_radius, c[facet_idx - begin] * mesh->facet_radius, z,
+				mesh->ring_colors[run->ring]);
+		}
+		return;
+	}
+
+	struct vertex_attrs attrs;
+	for (int32_t facet_idx = begin; facet_idx < end; ++facet_idx) {
+		ring_vertex_attrs(&attrs, mesh, run->ring, facet_idx, s[facet_idx - begin], c[facet_idx - begin]);
+		write_layout_vertex(run->vertices, run->layout, facet_idx - run->first_facet, &attrs);
+	}
+}
+
+void rp_generator_init(struct rp_generator *gen, const struct rp_data *data)
+{
+	assert(gen && data);
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+	assert(!data->soa);
+
+	const enum rp_index_type index_type = rp_index_type(data->facet_count);
+	*gen = (struct rp_generator){
+		.data = *data,
+		.index_type = index_type,
+		.vertex_bytes = rp_vertex_buffer_size(data->facet_count, data->layout),
+		.index_bytes = rp_index_count(data->facet_count, data->topology) * rp_index_type_size(index_type)
+	};
+	gen->data.vertices = NULL;
+	gen->data.indices = NULL;
+	gen->data.indices32 = NULL;
+	gen->data.table_cache = NULL;
+
+	const struct rp_vertex_layout *layout = data->layout ? data->layout : &default_layout;
+	size_t attr_bytes = 0;
+	for (int32_t attr = 0; attr < RP_ATTR_NUM; ++attr) {
+		const struct rp_attr_layout *attr_layout = &layout->attrs[attr];
+		if (attr_layout->format == RP_FORMAT_NONE) continue;
+		const size_t stride = attr_stride(layout, attr);
+		if (gen->vertex_stride == 0) gen->vertex_stride = stride;
+		// interleaved: one stride, and every attribute inside it
+		assert(stride == gen->vertex_stride);
+		assert(attr_layout->offset + attr_size(attr, attr_layout->format) <= stride);
+		attr_bytes += attr_size(attr, attr_layout->format);
+	}
+	assert(gen->vertex_stride != 0);
+	gen->clear_vertices = attr_bytes < gen->vertex_stride;
+}
+
+size_t rp_generator_write_vertices(struct rp_generator *gen, void *dst, size_t capacity)
+{
+	const size_t remaining = gen->vertex_bytes - gen->vertex_bytes_written;
+	if (remaining == 0) return 0;
+	const size_t stride = gen->vertex_stride;
+	assert(dst && ((uintptr_t)dst & (sizeof(float) - 1)) == 0);
+	assert(capacity >= (remaining < stride ? remaining : stride));
+
+	// the last vertex may end before its stride does, so the stream ends with it
+	const int32_t facet_count = gen->data.facet_count;
+	const size_t vertex_count = (size_t)facet_count * 4 + 2;
+	const size_t first = gen->vertex_bytes_written / stride;
+	const size_t end = capacity >= remaining ? vertex_count : first + capacity / stride;
+	const size_t bytes = (end == vertex_count ? gen->vertex_bytes : end * stride) - gen->vertex_bytes_written;
+	if (gen->clear_vertices) memset(dst, 0, bytes);
+
+	struct mesh_params mesh = mesh_from_data(&gen->data);
+	const bool default_vertices = !mesh.layout || layout_is_default(mesh.layout);
+	struct stream_run_ctx run = { .mesh = &mesh, .layout = default_vertices ? NULL : mesh.layout, .stride = stride };
+	const sincos_kernel sincos = precision_fns(mesh.precision).sincos;
+	for (int32_t ring = 0; ring < RP_RING_COUNT; ++ring) {
+		const size_t ring_first = (size_t)ring * (size_t)facet_count;
+		const size_t begin = first > ring_first ? first : ring_first;
+		const size_t ring_end = end < ring_first + (size_t)facet_count ? end : ring_first + (size_t)facet_count;
+		if (begin >= ring_end) continue;
+		run.vertices = (uint8_t *)dst + (begin - first) * stride;
+		run.ring = ring;
+		run.first_facet = (int32_t)(begin - ring_first);
+		mesh_ring_runs(&mesh, sincos, run.first_facet, (int32_t)(ring_end - ring_first), stream_run, &run);
+	}
+
+	for (int32_t center = 0; center < 2; ++center) {
+		const size_t vertex = (size_t)facet_count * 4 + (size_t)center;
+		if (vertex < first || vertex >= end) continue;
+		uint8_t *at = (uint8_t *)dst + (vertex - first) * stride;
+		if (default_vertices) {
+			set_vertex((float *)at, 0.0f, 0.0f, center ? -mesh.extrusion_depth : 0.0f, mesh.ring_colors[center * 2]);
+		} else {
+			struct vertex_attrs attrs;
+			center_vertex_attrs(&attrs, &mesh, center);
+			write_layout_vertex(at, mesh.layout, 0, &attrs);
+		}
+	}
+
+	gen->vertex_bytes_written += bytes;
+	return bytes;
+}
+
+size_t rp_generator_write_indices(struct rp_generator *gen, void *dst, size_t capacity)
+{
+	const size_t index_size = rp_index_type_size(gen->index_type);
+	const size_t remaining = gen->index_bytes - gen->index_bytes_written;
+	if (remaining == 0) return 0;
+	assert(dst && ((uintptr_t)dst & (index_size - 1)) == 0);
+	assert(capacity >= index_size);
+
+	const int32_t facet_count = gen->data.facet_count;
+	const size_t first = gen->index_bytes_written / index_size;
+	const size_t end = first + (capacity < remaining ? capacity : remaining) / index_size;
+
+	struct index_sections sections;
+	index_sections(facet_count, gen->data.topology, &sections);
+	for (uint32_t i = 0; i < sections.count; ++i) {
+		const struct index_section *section = &sections.sections[i];
+		const size_t unit_elements = (size_t)section->unit_elements;
+		const size_t section_end = section->offset + (size_t)section->unit_count * unit_elements;
+		size_t pos = first > section->offset ? first : section->offset;
+		const size_t stop = end < section_end ? end : section_end;
+		while (pos < stop) {
+			const int32_t unit = (int32_t)((pos - section->offset) / unit_elements);
+			const size_t within = (pos - section->offset) % unit_elements;
+			uint8_t *at = (uint8_t *)dst + (pos - first) * index_size;
+			if (within == 0 && stop - pos >= unit_elements) {
+				const int32_t units = (int32_t)((stop - pos) / unit_elements);
+				write_index_units(at, gen->index_type, section, facet_count, 0, unit, unit + units);
+				pos += (size_t)units * unit_elements;
+			} else {
+				uint32_t unit_indices[RP_MAX_SECTION_UNIT];
+				write_index_units(unit_indices, gen->index_type, section, facet_count, 0, unit, unit + 1);
+				const size_t count = unit_elements - within < stop - pos ? unit_elements - within : stop - pos;
+				memcpy(at, (uint8_t *)unit_indices + within * index_size, count * index_size);
+				pos += count;
+			}
+		}
+	}
+
+	const size_t bytes = (end - first) * index_size;
+	gen->index_bytes_written += bytes;
+	return bytes;
+}
+
+bool rp_generator_done(const struct rp_generator *gen)
+{
+	return gen->vertex_bytes_written == gen->vertex_bytes && gen->index_bytes_written == gen->index_bytes;
+}
+
+void rp_batch_size(const struct rp_data_desc *descs, size_t n, size_t *vertex_element_count,
+	size_t *index_element_count)
+{
+	size_t vertex_elements = 0;
+	size_t index_elements = 0;
+	for (size_t i = 0; i < n; ++i) {
+		vertex_elements += (size_t)RP_GET_VERTEX_ELEMENT_COUNT(descs[i].facet_count);
+		index_elements += (size_t)RP_GET_INDEX_ELEMENT_COUNT(descs[i].facet_count);
+	}
+	if (vertex_element_count) *vertex_element_count = vertex_elements;
+	if (index_element_count) *index_element_count = index_elements;
+}
+
+// prefix sum pass: every mesh's location in the shared blocks is known before anything is written
+static void batch_prefix(const struct rp_data_desc *descs, size_t n, struct rp_batch *batch)
+{
+	assert(descs || n == 0);
+	assert(batch->vertices && batch->ranges);
+	assert((batch->indices != NULL) != (batch->indices32 != NULL));
+
+	// summed wider than the ranges hold, so a batch past their limit trips the assert instead of wrapping
+	uint64_t base_vertex = 0;
+	uint64_t first_index = 0;
+	for (size_t i = 0; i < n; ++i) {
+		const struct rp_data_desc *desc = &descs[i];
+		assert_desc(desc->facet_count, desc->facet_radius, desc->extrusion_depth);
+		assert(batch->indices32 || rp_index_type(desc->facet_count) == RP_INDEX_TYPE_UINT16);
+		struct rp_mesh_range *range = &batch->ranges[i];
+		range->base_vertex = (uint32_t)base_vertex;
+		range->first_index = (uint32_t)first_index;
+		range->vertex_count = (uint32_t)(desc->facet_count * 4 + 2);
+		range->index_count = (uint32_t)RP_GET_INDEX_ELEMENT_COUNT(desc->facet_count);
+		base_vertex += range->vertex_count;
+		first_index += range->index_count;
+		assert(base_vertex <= UINT32_MAX && first_index <= UINT32_MAX);
+	}
+	// 16 bit indices have to reach every vertex they address: the whole block with absolute indices, else each mesh
+	assert(batch->indices32 || !batch->absolute_indices || base_vertex <= UINT16_MAX + 1u);
+}
+
+static void batch_gen_meshes(const struct rp_data_desc *descs, const struct rp_batch *batch, size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; ++i) {
+		const struct rp_data_desc *desc = &descs[i];
+		const struct rp_mesh_range *range = &batch->ranges[i];
+		const struct mesh_params mesh = {
+			.facet_count = desc->facet_count,
+			.facet_radius = desc->facet_radius,
+			.extrusion_depth = desc->extrusion_depth,
+			.ring_colors = default_ring_colors,
+			.precision = batch->precision,
+			.table_cache = batch->table_cache
+		};
+		gen_vertices(&batch->vertices[(size_t)range->base_vertex * RP_VERTEX_STRIDE], &mesh, 0, desc->facet_count);
+		const uint32_t base_vertex = batch->absolute_indices ? range->base_vertex : 0;
+		gen_indices(batch->indices ? &batch->indices[range->first_index] : NULL,
+			batch->indices32 ? &batch->indices32[range->first_index] : NULL, RP_TOPOLOGY_TRIANGLES,
+			desc->facet_count, base_vertex, 0, desc->facet_count);
+	}
+}
+
+void rp_gen_batch(const struct rp_data_desc *descs, size_t n, struct rp_batch *batch)
+{
+	batch_prefix(descs, n, batch);
+	batch_gen_meshes(descs, batch, 0, n);
+}
+
+// thread pool
+//
+// a run hands every worker (the calling thread is worker 0) a contiguous slice of the job indices. a slice is one
+// 64 bit atomic holding [begin, end); the owner pops jobs from the front and idle workers steal the back half of
+// another worker's slice, both with a single compare-and-swap, so uneven jobs balance out without any locking.
+
+#define RP_RANGE_PACK(begin, end) (((uint64_t)(end) << 32) | (uint64_t)(begin))
+#define RP_RANGE_BEGIN(range) ((uint32_t)(range))
+#define RP_RANGE_END(range) ((uint32_t)((range) >> 32))
+
+struct job_slice {
+	_Atomic uint64_t range;
+	char pad[64 - sizeof(uint64_t)]; // one cache line per slice, stealing shouldn't false-share with popping
+};
+
+struct worker_start;
+
+struct rp_thread_pool {
+	struct rp_allocator allocator;
+	uint32_t thread_count;
+	uint32_t thread_capacity; // the requested thread_count, which sized the arrays
+	struct job_slice *slices;
+
+	// the current run
+	rp_job_fn job;
+	void *job_data;
+	_Atomic uint32_t pending_jobs;
+
+#if defined(RP_HAS_THREADS)
+	pthread_t *threads;
+	struct worker_start *starts;
+	pthread_mutex_t mutex;
+	pthread_cond_t wake_cond;
+	pthread_cond_t idle_cond;
+	uint64_t generation;
+	uint32_t busy_workers;
+	bool shutdown;
+#endif
+};
+
+static bool pop_job(struct job_slice *slice, uint32_t *job_index)
+{
+	uint64_t range = atomic_load_explicit(&slice->range, memory_order_acquire);
+	for (;;) {
+		uint32_t begin = RP_RANGE_BEGIN(range);
+		uint32_t end = RP_RANGE_END(range);
+		if (begin >= end) return false;
+		if (atomic_compare_exchange_weak_explicit(&slice->range, &range, RP_RANGE_PACK(begin + 1, end),
+				memory_order_acq_rel, memory_order_acquire)) {
+			*job_index = begin;
+			return true;
+		}
+	}
+}
+
+static bool steal_jobs(struct job_slice *victim, uint32_t *stolen_begin, uint32_t *stolen_end)
+{
+	uint64_t range = atomic_load_explicit(&victim->range, memory_order_acquire);
+	for (;;) {
+		uint32_t begin = RP_RANGE_BEGIN(range);
+		uint32_t end = RP_RANGE_END(range);
+		if (begin >= end) return false;
+		uint32_t split = end - (end - begin + 1) / 2;
+		if (atomic_compare_exchange_weak_explicit(&victim->range, &range, RP_RANGE_PACK(begin, split),
+				memory_order_acq_rel, memory_order_acquire)) {
+			*stolen_begin = split;
+			*stolen_end = end;
+			return true;
+		}
+	}
+}
+
+static void work_jobs(struct rp_thread_pool *pool, uint32_t worker)
+{
+	struct job_slice *own = &pool->slices[worker];
+	for (;;) {
+		uint32_t job_index;
+		while (pop_job(own, &job_index)) {
+			pool->job(pool->job_data, job_index);
+			atomic_fetch_sub_explicit(&pool->pending_jobs, 1, memory_order_acq_rel);
+		}
+
+		// jobs are never added during a run, so one empty sweep over all victims means this worker is done
+		bool stole = false;
+		for (uint32_t i = 1; i < pool->thread_count && !stole; ++i) {
+			uint32_t stolen_begin, stolen_end;
+			if (steal_jobs(&pool->slices[(worker + i) % pool->thread_count], &stolen_begin, &stolen_end)) {
+				atomic_store_explicit(&own->range, RP_RANGE_PACK(stolen_begin, stolen_end), memory_order_release);
+				stole = true;
+			}
+		}
+		if (!stole) return;
+	}
+}
+
+#if defined(RP_HAS_THREADS)
+struct worker_start {
+	struct rp_thread_pool *pool;
+	uint32_t worker;
+};
+
+static void *worker_main(void *arg)
+{
+	const struct worker_start start = *(struct worker_start *)arg;
+	struct rp_thread_pool *pool = start.pool;
+
+	uint64_t seen_generation = 0;
+	pthread_mutex_lock(&pool->mutex);
+	for (;;) {
+		while (!pool->shutdown && pool->generation == seen_generation) {
+			pthread_cond_wait(&pool->wake_cond, &pool->mutex);
+		}
+		if (pool->shutdown) break;
+		seen_generation = pool->generation;
+		pthread_mutex_unlock(&pool->mutex);
+
+		work_jobs(pool, start.worker);
+
+		pthread_mutex_lock(&pool->mutex);
+		if (--pool->busy_workers == 0) pthread_cond_signal(&pool->idle_cond);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+	return NULL;
+}
+
+static uint32_t cpu_count(void)
+{
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (uint32_t)count : 1;
+}
+#endif
+
+struct rp_thread_pool *rp_thread_pool_create(const struct rp_thread_pool_desc *desc)
+{
+	uint32_t thread_count = desc ? desc->thread_count : 0;
+#if defined(RP_HAS_THREADS)
+	if (thread_count == 0) thread_count = cpu_count();
+#else
+	thread_count = 1;
+#endif
+
+	const struct rp_allocator allocator = allocator_or_default(desc ? desc->allocator : NULL);
+	struct rp_thread_pool *pool = mem_calloc(&allocator, sizeof(struct rp_thread_pool),
+		_Alignof(struct rp_thread_pool));
+	if (!pool) return NULL;
+	pool->allocator = allocator;
+	pool->thread_count = thread_count;
+	pool->thread_capacity = thread_count;
+	pool->slices = mem_calloc(&allocator, thread_count * sizeof(struct job_slice), _Alignof(struct job_slice));
+	if (!pool->slices) {
+		mem_free(&allocator, pool, sizeof(struct rp_thread_pool), _Alignof(struct rp_thread_pool));
+		return NULL;
+	}
+
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_init(&pool->mutex, NULL);
+	pthread_cond_init(&pool->wake_cond, NULL);
+	pthread_cond_init(&pool->idle_cond, NULL);
+	pool->threads = mem_calloc(&allocator, thread_count * sizeof(pthread_t), _Alignof(pthread_t));
+	pool->starts = mem_calloc(&allocator, thread_count * sizeof(struct worker_start), _Alignof(struct worker_start));
+
+	// worker 0 is whichever thread calls rp_thread_pool_run; if a thread can't be started the pool simply runs
+	// with fewer workers
+	uint32_t started = 1;
+	for (uint32_t i = 1; pool->threads && pool->starts && i < thread_count; ++i) {
+		pool->starts[i] = (struct worker_start){ .pool = pool, .worker = i };
+		if (pthread_create(&pool->threads[i], NULL, worker_main, &pool->starts[i]) != 0) break;
+		++started;
+	}
+	pool->thread_count = started;
+#endif
+	return pool;
+}
+
+void rp_thread_pool_destroy(struct rp_thread_pool *pool)
+{
+	if (!pool) return;
+	const struct rp_allocator allocator = pool->allocator;
+	const uint32_t capacity = pool->thread_capacity;
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_lock(&pool->mutex);
+	pool->shutdown = true;
+	pthread_cond_broadcast(&pool->wake_cond);
+	pthread_mutex_unlock(&pool->mutex);
+	for (uint32_t i = 1; i < pool->thread_count; ++i) {
+		pthread_join(pool->threads[i], NULL);
+	}
+	pthread_cond_destroy(&pool->idle_cond);
+	pthread_cond_destroy(&pool->wake_cond);
+	pthread_mutex_destroy(&pool->mutex);
+	mem_free(&allocator, pool->threads, capacity * sizeof(pthread_t), _Alignof(pthread_t));
+	mem_free(&allocator, pool->starts, capacity * sizeof(struct worker_start), _Alignof(struct worker_start));
+#endif
+	mem_free(&allocator, pool->slices, capacity * sizeof(struct job_slice), _Alignof(struct job_slice));
+	mem_free(&allocator, pool, sizeof(struct rp_thread_pool), _Alignof(struct rp_thread_pool));
+}
+
+uint32_t rp_thread_pool_thread_count(const struct rp_thread_pool *pool)
+{
+	return pool->thread_count;
+}
+
+void rp_thread_pool_run(struct rp_thread_pool *pool, rp_job_fn job, void *job_data, uint32_t job_count)
+{
+	if (job_count == 0) return;
+
+	pool->job = job;
+	pool->job_data = job_data;
+	atomic_store_explicit(&pool->pending_jobs, job_count, memory_order_relaxed);
+	for (uint32_t i = 0; i < pool->thread_count; ++i) {
+		uint64_t begin = (uint64_t)job_count * i / pool->thread_count;
+		uint64_t end = (uint64_t)job_count * (i + 1) / pool->thread_count;
+		atomic_store_explicit(&pool->slices[i].range, RP_RANGE_PACK(begin, end), memory_order_relaxed);
+	}
+
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_lock(&pool->mutex);
+	pool->busy_workers = pool->thread_count - 1;
+	++pool->generation;
+	pthread_cond_broadcast(&pool->wake_cond);
+	pthread_mutex_unlock(&pool->mutex);
+#endif
+
+	work_jobs(pool, 0);
+
+#if defined(RP_HAS_THREADS)
+	// waiting for the workers to go idle (not just for pending_jobs to hit zero) guarantees none of them is still
+	// sweeping the slices when the next run resets them
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->busy_workers > 0) {
+		pthread_cond_wait(&pool->idle_cond, &pool->mutex);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+#endif
+	assert(atomic_load(&pool->pending_jobs) == 0);
+}
+
+static void thread_pool_job_system_run(rp_job_fn job, void *job_data, uint32_t job_count, void *user_data)
+{
+	rp_thread_pool_run((struct rp_thread_pool *)user_data, job, job_data, job_count);
+}
+
+struct rp_job_system rp_thread_pool_job_system(struct rp_thread_pool *pool)
+{
+	return (struct rp_job_system){
+		.run = thread_pool_job_system_run,
+		.user_data = pool
+	};
+}
+
+static void run_jobs(const struct rp_job_system *jobs, rp_job_fn job, void *job_data, uint32_t job_count)
+{
+	if (jobs && jobs->run) {
+		jobs->run(job, job_data, job_count, jobs->user_data);
+		return;
+	}
+	for (uint32_t i = 0; i < job_count; ++i) {
+		job(job_data, i);
+	}
+}
+
+// parallel batch generation
+//
+// the batch is cut into jobs of roughly equal vertex count; a mesh belongs to the job whose vertex window contains
+// its base_vertex. every mesh is generated exactly as rp_gen_batch would, into its own disjoint range of the
+// shared blocks, so the output is bit-identical to the single-threaded path.
+#define RP_BATCH_JOB_VERTICES 16384
+#define RP_BATCH_MAX_JOBS 4096
+
+struct batch_job_data {
+	const struct rp_data_desc *descs;
+	const struct rp_batch *batch;
+	size_t mesh_count;
+	uint64_t total_vertices;
+	uint32_t job_count;
+};
+
+// first mesh whose base_vertex is >= vertex
+static size_t batch_lower_bound(const struct rp_batch *batch, size_t mesh_count, uint64_t vertex)
+{
+	size_t lo = 0;
+	size_t hi = mesh_count;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (batch->ranges[mid].base_vertex < vertex) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+static void batch_job(void *job_data, uint32_t job_index)
+{
+	const struct batch_job_data *data = job_data;
+	uint64_t window_begin = data->total_vertices * job_index / data->job_count;
+	uint64_t window_end = data->total_vertices * (job_index + 1) / data->job_count;
+	size_t begin = batch_lower_bound(data->batch, data->mesh_count, window_begin);
+	size_t end = batch_lower_bound(data->batch, data->mesh_count, window_end);
+	batch_gen_meshes(data->descs, data->batch, begin, end);
+}
+
+void rp_gen_batch_parallel(const struct rp_data_desc *descs, size_t n, struct rp_batch *batch,
+	const struct rp_job_system *jobs)
+{
+	batch_prefix(descs, n, batch);
+	if (n == 0) return;
+
+	// resolve the kernel before any job runs so the workers never race on the lazy selection
+	rp_get_kernel();
+
+	const struct rp_mesh_range *last = &batch->ranges[n - 1];
+	uint64_t total_vertices = (uint64_t)last->base_vertex + last->vertex_count;
+	uint64_t job_count = total_vertices / RP_BATCH_JOB_VERTICES;
+	if (job_count > n) job_count = n;
+	if (job_count > RP_BATCH_MAX_JOBS) job_count = RP_BATCH_MAX_JOBS;
+	if (job_count == 0) job_count = 1;
+
+	struct batch_job_data data = {
+		.descs = descs,
+		.batch = batch,
+		.mesh_count = n,
+		.total_vertices = total_vertices,
+		.job_count = (uint32_t)job_count
+	};
+	run_jobs(jobs, batch_job, &data, data.job_count);
+}
+
+// parallel single mesh generation: every facet's vertices and indices land at fixed offsets, so the facet range is
+// cut into equal chunks and each job runs rp_gen_range on one of them. chunks are a multiple of 8 facets so every
+// kernel keeps full vector iterations; the output is bit-identical to rp_gen.
+#define RP_RANGE_JOB_FACETS 16384
+
+struct range_job_data {
+	struct rp_data *data;
+	int32_t chunk_facets;
+};
+
+static void range_job(void *job_data, uint32_t job_index)
+{
+	const struct range_job_data *range = job_data;
+	int32_t facet_begin = (int32_t)job_index * range->chunk_facets;
+	int32_t facet_end = facet_begin + range->chunk_facets;
+	if (facet_end > range->data->facet_count) facet_end = range->data->facet_count;
+	rp_gen_range(range->data, facet_begin, facet_end);
+}
+
+void rp_gen_parallel(struct rp_data *data, const struct rp_job_system *jobs)
+{
+	assert_desc(data->facet_count, data->facet_radius, data->extrusion_depth);
+
+	rp_get_kernel();
+
+	struct range_job_data range = {
+		.data = data,
+		.chunk_facets = RP_RANGE_JOB_FACETS
+	};
+	uint32_t job_count = (uint32_t)((data->facet_count + range.chunk_facets - 1) / range.chunk_facets);
+	run_jobs(jobs, range_job, &range, job_count);
+}
+
+// mesh cache
+//
+// a cached mesh is one allocation: the entry, then the vertex block and the index block. keys hash to a shard, and
+// every shard has its own lock, chained hash table, recency list and share of the budget, so misses on different
+// shards never wait for each other.
+//
+// hits don't lock at all. a reader enters an epoch, walks the bucket chain with atomic loads and pins the entry by
+// bumping its reference count with a compare-and-swap; a hit only sets the entry's used bit instead of reordering
+// the list. anything the chain walk misses (a concurrent insert, a chain being rehashed) falls through to the
+// locked path, which looks again. the recency list is ordered by insertion and locked promotions, and eviction
+// gives used entries a second chance at the front before taking unpinned ones from the cold end.
+//
+// an entry's state is its reference count plus an unlisted bit. eviction unlists only an unpinned entry, with a
+// single compare-and-swap from 0, so it can't race a reader's pin; invalidation unlists pinned entries too and
+// the last release retires them. retired entries and replaced bucket arrays wait in a per-shard limbo list until
+// the epoch is two ahead of their retirement, when no reader can still hold a pointer into them.
+//
+// misses are single-flight: the first caller registers the key as pending and generates outside the lock, later
+// callers for the same key wait for it and share the result.
+
+#define RP_CACHE_DEFAULT_BUDGET ((size_t)16 << 20)
+#define RP_CACHE_DEFAULT_SHARDS 16
+#define RP_CACHE_MIN_BUCKETS 16
+#define RP_CACHE_STRIPES 32 // epoch reader counters, one cache line each, threads pick one round robin
+#define RP_CACHE_BLOCK_ALIGN 16
+#define RP_MESH_UNLISTED 0x80000000u
+#define RP_MESH_REFS 0x7fffffffu
+
+// the key as it is hashed and compared: no padding, the layout by value
+struct mesh_key {
+	int32_t facet_count;
+	uint32_t radius_bits;
+	uint32_t depth_bits;
+	uint32_t topology;
+	uint32_t precision;
+	struct rp_vertex_layout layout;
+	float ring_colors[RP_RING_COUNT][3];
+};
+
+struct cached_mesh {
+	struct rp_mesh mesh; // first, so handed out meshes convert back to their entry
+	_Atomic(struct cached_mesh *) chain[2]; // bucket chain links, one slot per bucket array generation
+	_Atomic uint32_t state; // reference count | RP_MESH_UNLISTED
+	_Atomic bool used;      // hit since eviction last looked at it
+	struct cached_mesh *prev; // recency list, reused as the limbo list once retired
+	struct cached_mesh *next;
+	uint64_t retired_epoch;
+	struct mesh_key key;
+	uint64_t hash;
+	size_t bytes;
+};
+
+struct bucket_array {
+	struct bucket_array *next_retired;
+	uint64_t retired_epoch;
+	size_t mask;
+	uint32_t chain_slot; // which of the entries' chain links this array's chains use
+	_Atomic(struct cached_mesh *) heads[];
+};
+
+struct pending_mesh {
+	struct pending_mesh *next;
+	const struct mesh_key *key;
+	uint64_t hash;
+	struct cached_mesh *result; // pinned once per waiter
+	uint32_t waiters;
+	bool done;
+};
+
+struct cache_shard {
+	_Atomic(struct bucket_array *) buckets;
+	struct cached_mesh *head; // most recently inserted or promoted
+	struct cached_mesh *tail;
+	struct cached_mesh *retired_meshes;
+	struct bucket_array *retired_buckets;
+	struct pending_mesh *pending;
+	size_t byte_budget;
+	size_t bytes;
+	uint32_t mesh_count;
+	uint64_t locked_hits;
+	uint64_t misses;
+	uint64_t shared_misses;
+	uint64_t evictions;
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_t mutex;
+	pthread_cond_t done_cond;
+#endif
+};
+
+struct epoch_stripe {
+	_Atomic uint32_t readers[2]; // by epoch parity
+	_Atomic uint64_t hits;
+	char pad[64 - 2 * sizeof(uint32_t) - sizeof(uint64_t)];
+};
+
+struct rp_cache {
+	struct epoch_stripe stripes[RP_CACHE_STRIPES];
+	_Atomic uint64_t epoch;
+	struct rp_allocator allocator;
+	struct rp_table_cache *table_cache;
+	struct cache_shard *shards;
+	uint32_t shard_mask;
+};
+
+static _Atomic uint32_t next_stripe;
+static _Thread_local uint32_t thread_stripe; // 0 until the thread's first lookup, then its stripe + 1
+
+static inline void shard_lock(struct cache_shard *shard)
+{
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_lock(&shard->mutex);
+#else
+	(void)shard;
+#endif
+}
+
+static inline void shard_unlock(struct cache_shard *shard)
+{
+#if defined(RP_HAS_THREADS)
+	pthread_mutex_unlock(&shard->mutex);
+#else
+	(void)shard;
+#endif
+}
+
+static void mesh_key_from_desc(const struct rp_cache_key *desc, struct mesh_key *key)
+{
+	memset(key, 0, sizeof(*key));
+	key->facet_count = desc->facet_count;
+	memcpy(&key->radius_bits, &desc->facet_radius, sizeof(float));
+	memcpy(&key->depth_bits, &desc->extrusion_depth, sizeof(float));
+	key->topology = (uint32_t)desc->topology;
+	key->precision = (uint32_t)desc->precision;
+	key->layout = desc->layout ? *desc->layout : default_layout;
+	// attributes that aren't written don't tell layouts apart, whatever their offset and stride hold
+	for (int32_t attr = 0; attr < RP_ATTR_NUM; ++attr) {
+		if (key->layout.attrs[attr].format == RP_FORMAT_NONE) key->layout.attrs[attr] = (struct rp_attr_layout){ 0 };
+	}
+	memcpy(key->ring_colors, ring_colors_or_default(desc->ring_colors), sizeof(key->ring_colors));
+}
+
+// fnv-1a over the key's 32 bit words, with a final mix so both halves are usable for shard and bucket selection
+static uint64_t mesh_key_hash(const struct mesh_key *key)
+{
+	uint32_t words[sizeof(struct mesh_key) / sizeof(uint32_t)];
+	memcpy(words, key, sizeof(words));
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); ++i) {
+		hash = (hash ^ words[i]) * 1099511628211ull;
+	}
+	return hash ^ (hash >> 29);
+}
+
+static inline struct cache_shard *cache_shard(const struct rp_cache *cache, uint64_t hash)
+{
+	return &cache->shards[(hash >> 40) & cache->shard_mask];
+}
+
+static inline struct epoch_stripe *cache_stripe(struct rp_cache *cache)
+{
+	if (thread_stripe == 0) {
+		thread_stripe = atomic_fetch_add_explicit(&next_stripe, 1, memory_order_relaxed) % RP_CACHE_STRIPES + 1;
+	}
+	return &cache->stripes[thread_stripe - 1];
+}
+
+// announces a reader in the current epoch; rechecking the epoch after the increment means whoever advances it
+// either sees this reader or this reader sees the new epoch and announces itself there instead. the fence pairs
+// with the one in epoch_tag: a reader that sees an epoch later than an unlink's tag also sees the unlink.
+static uint64_t epoch_enter(struct rp_cache *cache, struct epoch_stripe *stripe)
+{
+	for (;;) {
+		const uint64_t epoch = atomic_load(&cache->epoch);
+		atomic_fetch_add(&stripe->readers[epoch & 1], 1);
+		if (atomic_load(&cache->epoch) == epoch) {
+			atomic_thread_fence(memory_order_seq_cst);
+			return epoch;
+		}
+		atomic_fetch_sub(&stripe->readers[epoch & 1], 1);
+	}
+}
+
+static inline void epoch_exit(struct epoch_stripe *stripe, uint64_t epoch)
+{
+	atomic_fetch_sub_explicit(&stripe->readers[epoch & 1], 1, memory_order_release);
+}
+
+// the epoch something unlinked just now is retired in
+static inline uint64_t epoch_tag(struct rp_cache *cache)
+{
+	atomic_thread_fence(memory_order_seq_cst);
+	return atomic_load(&cache->epoch);
+}
+
+// moves to the next epoch once no reader is left in the previous one, whose parity the next epoch reuses
+static uint64_t epoch_try_advance(struct rp_cache *cache)
+{
+	uint64_t epoch = atomic_load(&cache->epoch);
+	for (uint32_t i = 0; i < RP_CACHE_STRIPES; ++i) {
+		if (atomic_load(&cache->stripes[i].readers[(epoch + 1) & 1]) != 0) return epoch;
+	}
+	if (atomic_compare_exchange_strong(&cache->epoch, &epoch, epoch + 1)) ++epoch;
+	return epoch;
+}
+
+// frees what was retired at least two epochs ago; called with the shard locked
+static void mesh_free(const struct rp_cache *cache, struct cached_mesh *entry)
+{
+	mem_free(&cache->allocator, entry, entry->bytes, RP_CACHE_BLOCK_ALIGN);
+}
+
+static inline size_t bucket_array_bytes(size_t bucket_count)
+{
+	return sizeof(struct bucket_array) + bucket_count * sizeof(_Atomic(struct cached_mesh *));
+}
+
+static void bucket_array_free(const struct rp_cache *cache, struct bucket_array *buckets)
+{
+	if (!buckets) return;
+	mem_free(&cache->allocator, buckets, bucket_array_bytes(buckets->mask + 1), _Alignof(struct bucket_array));
+}
+
+static void pending_free(const struct rp_cache *cache, struct pending_mesh *pending)
+{
+	mem_free(&cache->allocator, pending, sizeof(struct pending_mesh), _Alignof(struct pending_mesh));
+}
+
+static void shard_collect(struct rp_cache *cache, struct cache_shard *shard)
+{
+	if (!shard->retired_meshes && !shard->retired_buckets) return;
+	const uint64_t epoch = epoch_try_advance(cache);
+
+	struct cached_mesh **mesh_link = &shard->retired_meshes;
+	while (*mesh_link) {
+		struct cached_mesh *entry = *mesh_link;
+		if (entry->retired_epoch + 2 <= epoch) {
+			*mesh_link = entry->next;
+			mesh_free(cache, entry);
+		} else {
+			mesh_link = &entry->next;
+		}
+	}
+
+	struct bucket_array **bucket_link = &shard->retired_buckets;
+	while (*bucket_link) {
+		struct bucket_array *buckets = *bucket_link;
+		if (buckets->retired_epoch + 2 <= epoch) {
+			*bucket_link = buckets->next_retired;
+			bucket_array_free(cache, buckets);
+		} else {
+			bucket_link = &buckets->next_retired;
+		}
+	}
+}
+
+static void shard_retire(struct rp_cache *cache, struct cache_shard *shard, struct cached_mesh *entry)
+{
+	entry->retired_epoch = epoch_tag(cache);
+	entry->next = shard->retired_meshes;
+	shard->retired_meshes = entry;
+	shard_collect(cache, shard);
+}
+
+// pins a listed entry; fails once eviction or invalidation unlisted it
+static inline bool mesh_try_pin(struct cached_mesh *entry)
+{
+	uint32_t state = atomic_load_explicit(&entry->state, memory_order_relaxed);
+	while (!(state & RP_MESH_UNLISTED)) {
+		if (atomic_compare_exchange_weak_explicit(&entry->state, &state, state + 1, memory_order_acquire,
+			memory_order_relaxed)) return true;
+	}
+	return false;
+}
+
+static struct cached_mesh *shard_find(const struct cache_shard *shard, const struct mesh_key *key, uint64_t hash)
+{
+	const struct bucket_array *buckets = atomic_load_explicit(&shard->buckets, memory_order_acquire);
+	struct cached_mesh *entry = atomic_load_explicit(&buckets->heads[hash & buckets->mask], memory_order_acquire);
+	while (entry && (entry->hash != hash || memcmp(&entry->key, key, sizeof(*key)))) {
+		entry = atomic_load_explicit(&entry->chain[buckets->chain_slot], memory_order_acquire);
+	}
+	return entry;
+}
+
+static struct pending_mesh *shard_find_pending(const struct cache_shard *shard, const struct mesh_key *key,
+	uint64_t hash)
+{
+	struct pending_mesh *pending = shard->pending;
+	while (pending && (pending->hash != hash || memcmp(pending->key, key, sizeof(*key)))) {
+		pending = pending->next;
+	}
+	return pending;
+}
+
+static void shard_push_front(struct cache_shard *shard, struct cached_mesh *entry)
+{
+	entry->prev = NULL;
+	entry->next = shard->head;
+	if (shard->head) shard->head->prev = entry;
+	shard->head = entry;
+	if (!shard->tail) shard->tail = entry;
+}
+
+static void shard_unlink(struct cache_shard *shard, struct cached_mesh *entry)
+{
+	if (entry->prev) entry->prev->next = entry->next; else shard->head = entry->next;
+	if (entry->next) entry->next->prev = entry->prev; else shard->tail = entry->prev;
+}
+
+static struct bucket_array *bucket_array_create(const struct rp_cache *cache, size_t bucket_count)
+{
+	struct bucket_array *buckets = mem_calloc(&cache->allocator, bucket_array_bytes(bucket_count),
+		_Alignof(struct bucket_array));
+	if (buckets) buckets->mask = bucket_count - 1;
+	return buckets;
+}
+
+// doubles the bucket array once the shard is fuller than one entry per bucket. the new chains are built in the
+// chain slot the current array doesn't use, so readers still walking the old array never see a half relinked
+// chain; they at worst miss entries inserted since and retry under the lock. the new array reuses the slot of the
+// one before the old array, so growing waits until that one is reclaimed and no reader can be left in it. a failed
+// allocation or a pending reclamation keeps the old array, which only makes chains longer for a while.
+static void shard_grow(struct rp_cache *cache, struct cache_shard *shard)
+{
+	struct bucket_array *old_buckets = atomic_load_explicit(&shard->buckets, memory_order_relaxed);
+	if (shard->mesh_count <= old_buckets->mask) return;
+	shard_collect(cache, shard);
+	if (shard->retired_buckets) return;
+	struct bucket_array *buckets = bucket_array_create(cache, (old_buckets->mask + 1) * 2);
+	if (!buckets) return;
+	buckets->chain_slot = old_buckets->chain_slot ^ 1;
+	for (struct cached_mesh *entry = shard->head; entry; entry = entry->next) {
+		_Atomic(struct cached_mesh *) *head = &buckets->heads[entry->hash & buckets->mask];
+		atomic_store_explicit(&entry->chain[buckets->chain_slot], atomic_load_explicit(head, memory_order_relaxed),
+			memory_order_relaxed);
+		atomic_store_explicit(head, entry, memory_order_relaxed);
+	}
+	atomic_store_explicit(&shard->buckets, buckets, memory_order_release);
+	old_buckets->retired_epoch = epoch_tag(cache);
+	old_buckets->next_retired = shard->retired_buckets;
+	shard->retired_buckets = old_buckets;
+}
+
+static void shard_insert(struct rp_cache *cache, struct cache_shard *shard, struct cached_mesh *entry)
+{
+	struct bucket_array *buckets = atomic_load_explicit(&shard->buckets, memory_order_relaxed);
+	_Atomic(struct cached_mesh *) *head = &buckets->heads[entry->hash & buckets->mask];
+	atomic_store_explicit(&entry->chain[buckets->chain_slot], atomic_load_explicit(head, memory_order_relaxed),
+		memory_order_relaxed);
+	atomic_store_explicit(head, entry, memory_order_release);
+	shard_push_front(shard, entry);
+	shard->bytes += entry->bytes;
+	++shard->mesh_count;
+	shard_grow(cache, shard);
+}
+
+// takes an entry off the list and out of its chain; the caller retires it once it is unpinned
+static void shard_remove(struct cache_shard *shard, struct cached_mesh *entry)
+{
+	struct bucket_array *buckets = atomic_load_explicit(&shard->buckets, memory_order_relaxed);
+	_Atomic(struct cached_mesh *) *link = &buckets->heads[entry->hash & buckets->mask];
+	struct cached_mesh *chained;
+	while ((chained = atomic_load_explicit(link, memory_order_relaxed)) != entry) {
+		link = &chained->chain[buckets->chain_slot];
+	}
+	atomic_store_explicit(link, atomic_load_explicit(&entry->chain[buckets->chain_slot], memory_order_relaxed),
+		memory_order_release);
+	shard_unlink(shard, entry);
+	shard->bytes -= entry->bytes;
+	--shard->mesh_count;
+}
+
+// evicts unpinned meshes from the cold end until bytes more fit the budget, moving used ones back to the front
+// once; false if they still don't fit
+static bool shard_make_room(struct rp_cache *cache, struct cache_shard *shard, size_t bytes)
+{
+	if (bytes > shard->byte_budget) return false;
+	struct cached_mesh *entry = shard->tail;
+	uint32_t visits = shard->mesh_count * 2;
+	while (entry && visits-- > 0 && shard->bytes + bytes > shard->byte_budget) {
+		struct cached_mesh *prev = entry->prev;
+		uint32_t unpinned = 0;
+		if (atomic_exchange_explicit(&entry->used, false, memory_order_relaxed)) {
+			shard_unlink(shard, entry);
+			shard_push_front(shard, entry);
+		} else if (atomic_compare_exchange_strong(&entry->state, &unpinned, RP_MESH_UNLISTED)) {
+			shard_remove(shard, entry);
+			shard_retire(cache, shard, entry);
+			++shard->evictions;
+		}
+		entry = prev ? prev : shard->tail;
+	}
+	return shard->bytes + bytes <= shard->byte_budget;
+}
+
+static struct cached_mesh *cache_gen_mesh(const struct rp_cache *cache, const struct rp_cache_key *desc,
+	const struct mesh_key *key, uint64_t hash)
+{
+	const int32_t facet_count = desc->facet_count;
+	const enum rp_index_type index_type = rp_index_type(facet_count);
+	const size_t vertex_bytes = rp_vertex_buffer_size(facet_count, &key->layout);
+	const size_t index_count = rp_index_count(facet_count, desc->topology);
+	const size_t header_bytes = align_size(sizeof(struct cached_mesh), RP_CACHE_BLOCK_ALIGN);
+	const size_t bytes = header_bytes + align_size(vertex_bytes, RP_CACHE_BLOCK_ALIGN) +
+		index_count * rp_index_type_size(index_type);
+
+	struct cached_mesh *entry = mem_alloc(&cache->allocator, bytes, RP_CACHE_BLOCK_ALIGN);
+	if (!entry) return NULL;
+	uint8_t *vertices = (uint8_t *)entry + header_bytes;
+	void *indices = vertices + align_size(vertex_bytes, RP_CACHE_BLOCK_ALIGN);
+
+	rp_gen(&(struct rp_data){
+		.vertices = (float *)vertices,
+		.indices = index_type == RP_INDEX_TYPE_UINT16 ? indices : NULL,
+		.indices32 = index_type == RP_INDEX_TYPE_UINT32 ? indices : NULL,
+		.facet_count = facet_count,
+		.facet_radius = desc->facet_radius,
+		.extrusion_depth = desc->extrusion_depth,
+		.layout = desc->layout,
+		.ring_colors = &key->ring_colors[0][0],
+		.topology = desc->topology,
+		.precision = desc->precision,
+		.table_cache = cache->table_cache
+	});
+
+	entry->mesh = (struct rp_mesh){
+		.vertices = vertices,
+		.indices = indices,
+		.vertex_bytes = vertex_bytes,
+		.index_count = index_count,
+		.vertex_count = (uint32_t)facet_count * 4 + 2,
+		.index_type = index_type,
+		.topology = desc->topology
+	};
+	atomic_init(&entry->chain[0], NULL);
+	atomic_init(&entry->chain[1], NULL);
+	atomic_init(&entry->state, 0);
+	atomic_init(&entry->used, false);
+	entry->prev = entry->next = NULL;
+	entry->retired_epoch = 0;
+	entry->key = *key;
+	entry->hash = hash;
+	entry->bytes = bytes;
+	return entry;
+}
+
+// the locked half of a lookup: a second look at the table, joining a pending generation of the key, or
+// generating it as the first caller
+static struct cached_mesh *shard_get(struct rp_cache *cache, struct cache_shard *shard, const struct rp_cache_key *desc,
+	const struct mesh_key *key, uint64_t hash)
+{
+	shard_lock(shard);
+
+	struct cached_mesh *entry = shard_find(shard, key, hash);
+	if (entry) {
+		// listed entries are only unlisted under this lock, so the pin can't fail
+		atomic_fetch_add_explicit(&entry->state, 1, memory_order_acquire);
+		++shard->locked_hits;
+		shard_unlink(shard, entry);
+		shard_push_front(shard, entry);
+		shard_unlock(shard);
+		return entry;
+	}
+
+	struct pending_mesh *pending = shard_find_pending(shard, key, hash);
+	if (pending) {
+#if defined(RP_HAS_THREADS)
+		++shard->shared_misses;
+		++pending->waiters;
+		while (!pending->done) pthread_cond_wait(&shard->done_cond, &shard->mutex);
+		entry = pending->result;
+		if (--pending->waiters == 0) pending_free(cache, pending);
+#else
+		assert(!"a pending generation without threads means rp_cache_get was reentered");
+#endif
+		shard_unlock(shard);
+		return entry;
+	}
+
+	++shard->misses;
+	pending = mem_calloc(&cache->allocator, sizeof(struct pending_mesh), _Alignof(struct pending_mesh));
+	if (pending) {
+		pending->key = key;
+		pending->hash = hash;
+		pending->next = shard->pending;
+		shard->pending = pending;
+	}
+	shard_unlock(shard);
+
+	entry = cache_gen_mesh(cache, desc, key, hash);
+
+	shard_lock(shard);
+	// one reference for this caller and one per waiter, set before readers can see the entry. an over-budget mesh
+	// is still handed out, it just isn't kept.
+	const uint32_t refs = 1 + (pending ? pending->waiters : 0);
+	if (entry && shard_make_room(cache, shard, entry->bytes)) {
+		atomic_store_explicit(&entry->state, refs, memory_order_relaxed);
+		shard_insert(cache, shard, entry);
+	} else if (entry) {
+		atomic_store_explicit(&entry->state, RP_MESH_UNLISTED | refs, memory_order_relaxed);
+	}
+	if (pending) {
+		struct pending_mesh **link = &shard->pending;
+		while (*link != pending) link = &(*link)->next;
+		*link = pending->next;
+		pending->result = entry;
+		pending->done = true;
+#if defined(RP_HAS_THREADS)
+		if (pending->waiters > 0) pthread_cond_broadcast(&shard->done_cond);
+#endif
+		if (pending->waiters == 0) pending_free(cache, pending);
+	}
+	shard_unlock(shard);
+	return entry;
+}
+
+struct rp_cache *rp_cache_create(const struct rp_cache_desc *desc)
+{
+	const uint32_t requested_shards = desc && desc->shard_count ? desc->shard_count : RP_CACHE_DEFAULT_SHARDS;
+	uint32_t shard_count = 1;
+	while (shard_count < requested_shards) shard_count <<= 1;
+	const size_t byte_budget = desc && desc->byte_budget ? desc->byte_budget : RP_CACHE_DEFAULT_BUDGET;
+
+	const struct rp_allocator allocator = allocator_or_default(desc ? desc->allocator : NULL);
+	struct rp_cache *cache = mem_calloc(&allocator, sizeof(struct rp_cache), _Alignof(struct rp_cache));
+	if (!cache) return NULL;
+	cache->allocator = allocator;
+	cache->shards = mem_calloc(&allocator, shard_count * sizeof(struct cache_shard), _Alignof(struct cache_shard));
+	if (!cache->shards) {
+		mem_free(&allocator, cache, sizeof(struct rp_cache), _Alignof(struct rp_cache));
+		return NULL;
+	}
+	cache->shard_mask = shard_count - 1;
+	cache->table_cache = desc ? desc->table_cache : NULL;
+
+	bool complete = true;
+	for (uint32_t i = 0; i < shard_count; ++i) {
+		struct cache_shard *shard = &cache->shards[i];
+		struct bucket_array *buckets = bucket_array_create(cache, RP_CACHE_MIN_BUCKETS);
+		atomic_init(&shard->buckets, buckets);
+		complete &= buckets != NULL;
+		shard->byte_budget = byte_budget / shard_count;
+#if defined(RP_HAS_THREADS)
+		pthread_mutex_init(&shard->mutex, NULL);
+		pthread_cond_init(&shard->done_cond, NULL);
+#endif
+	}
+	if (!complete) {
+		rp_cache_destroy(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+// every mesh must have been released and no lookup may be running
+void rp_cache_destroy(struct rp_cache *cache)
+{
+	if (!cache) return;
+	for (uint32_t i = 0; i <= cache->shard_mask; ++i) {
+		struct cache_shard *shard = &cache->shards[i];
+		assert(!shard->pending);
+		struct cached_mesh *entry = shard->head;
+		while (entry) {
+			struct cached_mesh *next = entry->next;
+			assert(atomic_load(&entry->state) == 0);
+			mesh_free(cache, entry);
+			entry = next;
+		}
+		entry = shard->retired_meshes;
+		while (entry) {
+			struct cached_mesh *next = entry->next;
+			mesh_free(cache, entry);
+			entry = next;
+		}
+		struct bucket_array *buckets = shard->retired_buckets;
+		while (buckets) {
+			struct bucket_array *next = buckets->next_retired;
+			bucket_array_free(cache, buckets);
+			buckets = next;
+		}
+		bucket_array_free(cache, atomic_load(&shard->buckets));
+#if defined(RP_HAS_THREADS)
+		pthread_mutex_destroy(&shard->mutex);
+		pthread_cond_destroy(&shard->done_cond);
+#endif
+	}
+	const struct rp_allocator allocator = cache->allocator;
+	mem_free(&allocator, cache->shards, (size_t)(cache->shard_mask + 1) * sizeof(struct cache_shard),
+		_Alignof(struct cache_shard));
+	mem_free(&allocator, cache, sizeof(struct rp_cache), _Alignof(struct rp_cache));
+}
+
+const struct rp_mesh *rp_cache_get(struct rp_cache *cache, const struct rp_cache_key *desc)
+{
+	assert(cache && desc);
+	assert_desc(desc->facet_count, desc->facet_radius, desc->extrusion_depth);
+	assert(desc->topology >= RP_TOPOLOGY_TRIANGLES && desc->topology <= RP_TOPOLOGY_STRIP_DEGENERATE);
+	assert(desc->precision >= RP_PRECISION_FAST && desc->precision <= RP_PRECISION_COARSE);
+
+	struct mesh_key key;
+	mesh_key_from_desc(desc, &key);
+	const uint64_t hash = mesh_key_hash(&key);
+	struct cache_shard *shard = cache_shard(cache, hash);
+
+	struct epoch_stripe *stripe = cache_stripe(cache);
+	const uint64_t epoch = epoch_enter(cache, stripe);
+	struct cached_mesh *entry = shard_find(shard, &key, hash);
+	const bool pinned = entry && mesh_try_pin(entry);
+	epoch_exit(stripe, epoch);
+
+	if (pinned) {
+		atomic_fetch_add_explicit(&stripe->hits, 1, memory_order_relaxed);
+		if (!atomic_load_explicit(&entry->used, memory_order_relaxed)) {
+			atomic_store_explicit(&entry->used, true, memory_order_relaxed);
+		}
+	} else {
+		entry = shard_get(cache, shard, desc, &key, hash);
+	}
+	return entry ? &entry->mesh : NULL;
+}
+
+void rp_cache_release(struct rp_cache *cache, const struct rp_mesh *mesh)
+{
+	if (!mesh) return;
+	struct cached_mesh *entry = (struct cached_mesh *)mesh;
+	const uint32_t state = atomic_fetch_sub_explicit(&entry->state, 1, memory_order_acq_rel);
+	assert(state & RP_MESH_REFS);
+	// the last reference to an unlisted mesh: nothing can pin it anymore
+	if (state == (RP_MESH_UNLISTED | 1)) {
+		struct cache_shard *shard = cache_shard(cache, entry->hash);
+		shard_lock(shard);
+		shard_retire(cache, shard, entry);
+		shard_unlock(shard);
+	}
+}
+
+void rp_cache_invalidate(struct rp_cache *cache)
+{
+	for (uint32_t i = 0; i <= cache->shard_mask; ++i) {
+		struct cache_shard *shard = &cache->shards[i];
+		shard_lock(shard);
+		struct cached_mesh *entry = shard->head;
+		while (entry) {
+			struct cached_mesh *next = entry->next;
+			shard_remove(shard, entry);
+			const uint32_t state = atomic_fetch_or(&entry->state, RP_MESH_UNLISTED);
+			if ((state & RP_MESH_REFS) == 0) shard_retire(cache, shard, entry);
+			entry = next;
+		}
+		shard_unlock(shard);
+	}
+}
+
+struct rp_cache_stats rp_cache_get_stats(struct rp_cache *cache)
+{
+	struct rp_cache_stats stats = { 0 };
+	for (uint32_t i = 0; i < RP_CACHE_STRIPES; ++i) {
+		stats.hits += atomic_load_explicit(&cache->stripes[i].hits, memory_order_relaxed);
+	}
+	for (uint32_t i = 0; i <= cache->shard_mask; ++i) {
+		struct cache_shard *shard = &cache->shards[i];
+		shard_lock(shard);
+		stats.hits += shard->locked_hits;
+		stats.misses += shard->misses;
+		stats.shared_misses += shard->shared_misses;
+		stats.evictions += shard->evictions;
+		stats.bytes += shard->bytes;
+		stats.mesh_count += shard->mesh_count;
+		shard_unlock(shard);
+	}
+	return stats;
+}
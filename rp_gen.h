@@ -2,24 +2,431 @@
 #define RP_GEN_H
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 
+// the default vertex layout: xyz position followed by rgba color, all f32
 #define RP_VERTEX_STRIDE 7
 // 4 vertices per facet (1 front face, 1 back face, 2 edge) + 2 center vertices
-#define RP_GET_VERTEX_ELEMENT_COUNT(facet_count) ((facet_count * 4 + 2) * RP_VERTEX_STRIDE)
+#define RP_GET_VERTEX_ELEMENT_COUNT(facet_count) (((facet_count) * 4 + 2) * RP_VERTEX_STRIDE)
 
 #define RP_INDEX_STRIDE 3
 // 4 triangles per facet (each triangle represented by 3 indicies)
-#define RP_GET_INDEX_ELEMENT_COUNT(facet_count) ((facet_count * 4) * RP_INDEX_STRIDE)
+#define RP_GET_INDEX_ELEMENT_COUNT(facet_count) (((facet_count) * 4) * RP_INDEX_STRIDE)
+
+// vertex layouts. every attribute can be placed anywhere in the vertex block with its own offset and stride, so
+// one layout describes interleaved vertices, separate attribute streams or anything in between.
+//
+// unit prisms: generated with facet_radius and extrusion_depth 1 and RP_ATTR_BACK in the layout, one mesh per facet
+// count serves every radius and depth. the vertex shader scales xy by the radius and places flagged vertices at
+// -depth, so changing either is a uniform update with no generation and no upload.
+enum rp_attr {
+	RP_ATTR_POSITION, // xyz
+	RP_ATTR_NORMAL,   // xyz: +z front cap, -z back cap, radial on the edge rings
+	RP_ATTR_UV,       // caps map the disc onto [0, 1]^2, edges run u around the prism and v from front (0) to back (1)
+	RP_ATTR_COLOR,    // rgba
+	RP_ATTR_FACET_ID, // the facet index, -1 on the two center vertices
+	RP_ATTR_BACK,     // 1 on the back facet ring, back edge ring and back center vertex, 0 on the front ones
+	RP_ATTR_NUM
+};
+
+enum rp_format {
+	RP_FORMAT_NONE = 0, // attribute is not written
+	RP_FORMAT_F32,
+	RP_FORMAT_F16,
+	RP_FORMAT_SNORM16,  // clamped to [-1, 1]
+	RP_FORMAT_UNORM8,   // clamped to [0, 1]
+	RP_FORMAT_NUM
+};
+
+struct rp_attr_layout {
+	enum rp_format format;
+	uint32_t offset; // bytes from the start of the vertex block to the first vertex's attribute
+	uint32_t stride; // bytes between consecutive vertices' attribute, 0 = tightly packed
+};
+
+struct rp_vertex_layout {
+	struct rp_attr_layout attrs[RP_ATTR_NUM];
+};
+
+// bytes needed to hold a mesh in the given layout (NULL = the default RP_VERTEX_STRIDE float layout)
+size_t rp_vertex_buffer_size(int32_t facet_count, const struct rp_vertex_layout *layout);
+
+// structure of arrays output: each stream holds facet_count * 4 + 2 entries in the usual vertex order. colors is
+// optional (4 floats per vertex), leave it NULL for position-only output.
+struct rp_soa {
+	float *x;
+	float *y;
+	float *z;
+	float *colors;
+};
+
+// the memory a mesh is written to
+enum rp_stream {
+	RP_STREAM_VERTICES = 0, // the vertex block
+	RP_STREAM_SOA_X,
+	RP_STREAM_SOA_Y,
+	RP_STREAM_SOA_Z,
+	RP_STREAM_SOA_COLORS,
+	RP_STREAM_INDICES,
+	RP_STREAM_NUM
+};
+
+// 16 bit indices reach facet counts up to 16383; rp_index_type picks the smallest type a mesh needs
+enum rp_index_type {
+	RP_INDEX_TYPE_UINT16,
+	RP_INDEX_TYPE_UINT32
+};
+
+enum rp_index_type rp_index_type(int32_t facet_count);
+size_t rp_index_type_size(enum rp_index_type index_type);
+
+// index topologies. the strip variants cut the index count from 12 to about 4 per facet: each cap becomes a zig-zag
+// strip (the center vertices stay in the vertex block but are not referenced) and the side wall one closed strip.
+enum rp_topology {
+	RP_TOPOLOGY_TRIANGLES = 0,    // indexed triangle list
+	RP_TOPOLOGY_STRIP_RESTART,    // triangle strips split by primitive restart indices (0xFFFF / 0xFFFFFFFF)
+	RP_TOPOLOGY_STRIP_DEGENERATE  // one triangle strip joined by degenerate triangles, for apis without restart
+};
+
+// index elements a mesh needs in the given topology
+size_t rp_index_count(int32_t facet_count, enum rp_topology topology);
+
+// sin/cos precision tiers. errors are the largest distance of a ring position from the exact circle, in units of
+// facet_radius.
+enum rp_precision {
+	RP_PRECISION_FAST = 0, // the active kernel's minimax polynomials, below 1 ulp of facet_radius from exact
+	RP_PRECISION_EXACT,    // libm sinf/cosf on the scalar kernel whatever kernel is active, about 1e-7
+	// for lod meshes: libm seeds for the first 8 facets of every run of up to 1024 facets, the rest of the run
+	// rotated on from them by a recurrence. its error grows with the run length; at 1024 it stays below 1e-5
+	RP_PRECISION_COARSE
+};
 
 struct rp_data {
 	float *vertices;
+	// set exactly one of the two; 16 bit indices assert that the mesh fits rp_index_type
 	uint16_t *indices;
+	uint32_t *indices32;
 	int32_t facet_count;
 	float facet_radius;
 	float extrusion_depth;
+	// NULL writes RP_VERTEX_STRIDE floats per vertex (position, color). with a layout, vertices points at a block
+	// of rp_vertex_buffer_size bytes which is written exactly as the layout describes.
+	const struct rp_vertex_layout *layout;
+	// non-NULL writes the vertices to these streams instead; vertices and layout are ignored
+	const struct rp_soa *soa;
+	// optional: rgb of the front facet, front edge, back facet and back edge rings (12 floats), alpha is always 1.
+	// NULL = red, green, blue, green
+	const float *ring_colors;
+	// indices hold rp_index_count(facet_count, topology) elements
+	enum rp_topology topology;
+	enum rp_precision precision;
+	// optional: reuse the unit circle and index pattern of facet_count across calls instead of computing them
+	struct rp_table_cache *table_cache;
 };
 
+// single allocation planning: rp_plan places every stream of a mesh in one block, each at a multiple of
+// RP_PLAN_ALIGNMENT so vector stores into any of them start on a cache line. allocate total_bytes aligned to
+// alignment (total_bytes is a multiple of it, as aligned_alloc wants) and point an rp_data at it with rp_plan_bind.
+#define RP_PLAN_ALIGNMENT 64
+
+struct rp_plan_desc {
+	int32_t facet_count;
+	const struct rp_vertex_layout *layout; // NULL = the default RP_VERTEX_STRIDE float layout
+	enum rp_topology topology;
+	bool soa;        // x, y and z streams instead of the vertex block
+	bool soa_colors; // and a colors stream
+	bool no_indices; // vertices only, for rp_gen_vertices
+};
+
+struct rp_plan {
+	size_t total_bytes;
+	size_t alignment;
+	size_t offsets[RP_STREAM_NUM]; // bytes from the start of the block
+	size_t sizes[RP_STREAM_NUM];   // bytes, 0 = not in the block
+	uint32_t vertex_count;
+	size_t index_count;
+	enum rp_index_type index_type; // the smallest type the facet count fits
+};
+
+struct rp_plan rp_plan(const struct rp_plan_desc *desc);
+// sets the output pointers of data (and the streams of soa, which must be non-NULL for an soa plan) to the planned
+// streams of block. the other fields of data are left alone.
+void rp_plan_bind(const struct rp_plan *plan, void *block, struct rp_data *data, struct rp_soa *soa);
+
+// vertex emission kernels. the simd kernels evaluate sin/cos with a polynomial and stay within 1 ulp of
+// facet_radius of RP_KERNEL_SCALAR, the libm reference. build with RP_NO_SIMD to compile the scalar kernel only.
+enum rp_kernel {
+	RP_KERNEL_AUTO = 0, // widest kernel supported by the running cpu (cpuid on x86)
+	RP_KERNEL_SCALAR,
+	RP_KERNEL_SSE2,
+	RP_KERNEL_AVX2,
+	RP_KERNEL_NEON,
+	RP_KERNEL_WASM_SIMD128
+};
+
+// returns false and keeps the current kernel if the requested one is not compiled in or not supported by the cpu
+bool rp_set_kernel(enum rp_kernel kernel);
+enum rp_kernel rp_get_kernel(void);
+
+// allocators. every object that allocates (table caches, mesh caches, thread pools) takes an optional allocator in
+// its desc and makes all of its allocations through it; NULL uses malloc and free. an allocator handed to an object
+// shared between threads is called from those threads. free gets the size and alignment alloc was called with.
+struct rp_allocator {
+	void *(*alloc)(size_t size, size_t alignment, void *user_data); // NULL when out of memory
+	void (*free)(void *ptr, size_t size, size_t alignment, void *user_data);
+	void *user_data;
+};
+
+// bump arena over caller memory: allocations advance an offset and free does nothing, rp_arena_reset drops
+// everything at once. not thread safe.
+struct rp_arena {
+	uint8_t *memory;
+	size_t capacity;
+	size_t used;
+	size_t peak; // the highest used since rp_arena_init
+};
+
+void rp_arena_init(struct rp_arena *arena, void *memory, size_t capacity);
+void *rp_arena_alloc(struct rp_arena *arena, size_t size, size_t alignment); // NULL if it doesn't fit
+void rp_arena_reset(struct rp_arena *arena);
+struct rp_allocator rp_arena_allocator(struct rp_arena *arena);
+
+// fixed-size block pool over caller memory, for allocations that all have about the same size: alloc and free are
+// a free list pop and push. requests larger than block_size fail. not thread safe.
+struct rp_fixed_pool {
+	uint8_t *memory;
+	size_t block_size; // rounded up to RP_FIXED_POOL_ALIGNMENT, so every block is aligned to it
+	uint32_t block_count;
+	uint32_t free_count;
+	void *free_list;
+};
+
+#define RP_FIXED_POOL_ALIGNMENT 64
+
+// memory must be aligned to RP_FIXED_POOL_ALIGNMENT
+void rp_fixed_pool_init(struct rp_fixed_pool *pool, void *memory, size_t capacity, size_t block_size);
+void *rp_fixed_pool_alloc(struct rp_fixed_pool *pool); // NULL if every block is in use
+void rp_fixed_pool_free(struct rp_fixed_pool *pool, void *block);
+struct rp_allocator rp_fixed_pool_allocator(struct rp_fixed_pool *pool);
+
+// opt-in cache of facet tables, the parts of a mesh that depend on facet_count alone: unit circles (sin/cos per
+// facet, keyed by facet_count, kernel and precision) and index patterns (keyed by facet_count, topology and index
+// type). repeated generation with a known facet count is a scale-and-store loop without trig and an index copy,
+// bit-identical to uncached output. tables are evicted least recently used first to stay within the budget. a
+// cache may be shared between threads.
+struct rp_table_cache_desc {
+	size_t byte_budget; // 0 = 1 MiB
+	const struct rp_allocator *allocator; // optional, copied
+};
+
+struct rp_table_cache_stats {
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t evictions;
+	size_t bytes;
+	uint32_t table_count;
+};
+
+struct rp_table_cache;
+
+struct rp_table_cache *rp_table_cache_create(const struct rp_table_cache_desc *desc);
+void rp_table_cache_destroy(struct rp_table_cache *cache);
+// drops the tables of facet_count, or every table for 0; tables in use by a running rp_gen are freed after it
+void rp_table_cache_invalidate(struct rp_table_cache *cache, int32_t facet_count);
+struct rp_table_cache_stats rp_table_cache_get_stats(struct rp_table_cache *cache);
+// the rp_index_count(facet_count, topology) indices every mesh of facet_count shares whatever its radius and depth,
+// pinned until released. NULL if the pattern doesn't fit the budget; rp_gen_indices writes it then.
+const void *rp_table_cache_acquire_indices(struct rp_table_cache *cache, int32_t facet_count,
+	enum rp_topology topology, enum rp_index_type index_type);
+void rp_table_cache_release_indices(struct rp_table_cache *cache, const void *indices);
+
+// even facet counts evaluate sin/cos for a quarter or eighth of the ring only and come out exactly mirror and
+// point symmetric
 void rp_gen(struct rp_data *data);
 
+// the two halves of rp_gen. vertices depend on every parameter but indices only on facet_count and topology, so a
+// mesh whose radius or depth changes keeps its index buffer and regenerates the vertices alone.
+void rp_gen_vertices(struct rp_data *data); // indices and indices32 are ignored
+void rp_gen_indices(struct rp_data *data);  // reads facet_count, topology, the index pointers and table_cache only
+
+// in-place updates of a vertex block rp_gen wrote: data describes the mesh after the edit, with everything but
+// the edited parameter as it was generated. the bytes written are reported as byte ranges of the vertex block, or
+// of the soa streams; a range may span unchanged bytes between strided writes. uploading just the ranges brings a
+// gpu copy of the block up to date, and the result is bit-identical to regenerating the mesh.
+#define RP_MAX_DIRTY_RANGES 8
+
+struct rp_byte_range {
+	enum rp_stream stream;
+	size_t offset;
+	size_t size;
+};
+
+struct rp_dirty_ranges {
+	uint32_t count;
+	struct rp_byte_range ranges[RP_MAX_DIRTY_RANGES];
+};
+
+// extrusion_depth changed: rewrites the z of the back facet ring, the back edge ring and the back center vertex
+void rp_update_depth(struct rp_data *data, struct rp_dirty_ranges *dirty);
+// facet_radius changed: rewrites x and y of the four rings, from the table cache's unit circle when there is one
+void rp_update_radius(struct rp_data *data, struct rp_dirty_ranges *dirty);
+// ring_colors changed: rewrites the color of every vertex
+void rp_update_colors(struct rp_data *data, struct rp_dirty_ranges *dirty);
+
+// generates only facets [facet_begin, facet_end): their four ring vertices and their indices in every section,
+// plus the two center vertices when facet_begin is 0. disjoint ranges write disjoint memory, so ranges covering
+// [0, facet_count) may run concurrently and together produce exactly what rp_gen does.
+void rp_gen_range(struct rp_data *data, int32_t facet_begin, int32_t facet_end);
+
+// streaming generation: a generator writes one mesh's vertex block and index block in caller-sized chunks, so a
+// mesh of any facet count can be produced with O(chunk) memory and piped into a file, a socket or a staging buffer.
+// the two streams advance independently, and concatenating a stream's chunks gives exactly the block rp_gen writes
+// (bytes between the attributes of a vertex are zeroed). generators hold no allocations and need no cleanup.
+struct rp_generator {
+	struct rp_data data;           // the mesh; output pointers, soa and table_cache are ignored
+	enum rp_index_type index_type; // the smallest type the facet count fits
+	size_t vertex_stride;          // bytes per vertex; vertex chunks hold whole vertices
+	// progress in bytes per stream
+	size_t vertex_bytes_written;
+	size_t vertex_bytes;           // rp_vertex_buffer_size
+	size_t index_bytes_written;
+	size_t index_bytes;
+	bool clear_vertices;           // the layout leaves gaps inside a vertex
+};
+
+// the layout must be interleaved: every attribute shares one stride and lies within it. data's layout and
+// ring_colors are referenced, not copied.
+void rp_generator_init(struct rp_generator *gen, const struct rp_data *data);
+// write the next chunk of a stream to dst and return its size in bytes, at most capacity; 0 once the stream is
+// complete. dst is aligned like the blocks rp_gen writes (4 bytes for vertices, the index size for indices). a vertex
+// chunk needs room for at least one vertex (or the rest of the stream), an index chunk for one index.
+size_t rp_generator_write_vertices(struct rp_generator *gen, void *dst, size_t capacity);
+size_t rp_generator_write_indices(struct rp_generator *gen, void *dst, size_t capacity);
+bool rp_generator_done(const struct rp_generator *gen);
+
+// batched generation: n meshes written back-to-back into one vertex block and one index block. a batch holds at
+// most UINT32_MAX vertices and UINT32_MAX index elements in total, as rp_mesh_range offsets are 32 bit.
+struct rp_data_desc {
+	int32_t facet_count;
+	float facet_radius;
+	float extrusion_depth;
+};
+
+// where a mesh of a batch lives inside the shared blocks, in vertices and index elements
+struct rp_mesh_range {
+	uint32_t base_vertex;
+	uint32_t first_index;
+	uint32_t vertex_count;
+	uint32_t index_count;
+};
+
+// batches are always written as triangle lists
+struct rp_batch {
+	float *vertices;              // rp_batch_size vertex elements
+	uint16_t *indices;            // rp_batch_size index elements, set exactly one of indices and indices32
+	uint32_t *indices32;
+	struct rp_mesh_range *ranges; // n entries, filled by rp_gen_batch
+	// false: each mesh's indices start at 0 (draw with a vertex buffer offset of base_vertex)
+	// true: base_vertex is baked into the indices so every mesh draws from the start of the vertex block
+	bool absolute_indices;
+	// see rp_data
+	enum rp_precision precision;
+	struct rp_table_cache *table_cache; // optional
+};
+
+void rp_batch_size(const struct rp_data_desc *descs, size_t n, size_t *vertex_element_count,
+	size_t *index_element_count);
+void rp_gen_batch(const struct rp_data_desc *descs, size_t n, struct rp_batch *batch);
+
+// jobs and job systems. run must call job(job_data, i) once for every i in [0, job_count) and only return once
+// all of them finished; plug in an engine's scheduler here or use the built-in thread pool.
+typedef void (*rp_job_fn)(void *job_data, uint32_t job_index);
+
+struct rp_job_system {
+	void (*run)(rp_job_fn job, void *job_data, uint32_t job_count, void *user_data);
+	void *user_data;
+};
+
+// built-in work-stealing pool. runs are not reentrant: one rp_thread_pool_run at a time per pool, and jobs must
+// not run the pool they are running on. built with RP_NO_THREADS (or emscripten without pthreads) every pool runs
+// its jobs on the calling thread.
+struct rp_thread_pool_desc {
+	uint32_t thread_count; // workers including the calling thread, 0 = one per online cpu
+	const struct rp_allocator *allocator; // optional, copied; only used by create and destroy
+};
+
+struct rp_thread_pool;
+
+struct rp_thread_pool *rp_thread_pool_create(const struct rp_thread_pool_desc *desc);
+void rp_thread_pool_destroy(struct rp_thread_pool *pool);
+uint32_t rp_thread_pool_thread_count(const struct rp_thread_pool *pool);
+void rp_thread_pool_run(struct rp_thread_pool *pool, rp_job_fn job, void *job_data, uint32_t job_count);
+struct rp_job_system rp_thread_pool_job_system(struct rp_thread_pool *pool);
+
+// rp_gen for one large mesh, its facet range split over a job system (NULL runs serially); bit-identical to rp_gen
+void rp_gen_parallel(struct rp_data *data, const struct rp_job_system *jobs);
+
+// rp_gen_batch spread over a job system (NULL runs serially); the output is bit-identical to rp_gen_batch
+void rp_gen_batch_parallel(const struct rp_data_desc *descs, size_t n, struct rp_batch *batch,
+	const struct rp_job_system *jobs);
+
+
+// memoizing mesh cache. rp_cache_get returns the mesh of a key, generating it on the first request and sharing it
+// afterwards; the blocks are immutable and stay valid until the caller releases them, even if the mesh is evicted
+// or invalidated meanwhile. meshes are evicted roughly least recently used first to stay within the budget, and a
+// mesh larger than a shard's budget is generated for its caller but not kept.
+//
+// a cache may be shared between threads: hits take no lock, keys are spread over independently locked shards, and
+// concurrent misses of one key generate it once while the other callers wait for the result.
+struct rp_cache_desc {
+	size_t byte_budget;                 // 0 = 16 MiB, split evenly between the shards
+	uint32_t shard_count;               // 0 = 16, rounded up to a power of two
+	struct rp_table_cache *table_cache; // optional, used to generate misses
+	const struct rp_allocator *allocator; // optional, copied
+};
+
+// everything a cached mesh is generated from. the layout is compared by value, so it may be a temporary. indices
+// use the smallest rp_index_type of the facet count.
+struct rp_cache_key {
+	int32_t facet_count;
+	float facet_radius;
+	float extrusion_depth;
+	const struct rp_vertex_layout *layout; // NULL = the default RP_VERTEX_STRIDE float layout
+	const float *ring_colors;              // see rp_data, compared by value
+	enum rp_topology topology;
+	enum rp_precision precision;
+};
+
+struct rp_mesh {
+	const void *vertices;     // vertex_bytes, written as the key's layout describes
+	const void *indices;      // index_count elements of index_type
+	size_t vertex_bytes;
+	size_t index_count;
+	uint32_t vertex_count;
+	enum rp_index_type index_type;
+	enum rp_topology topology;
+};
+
+struct rp_cache_stats {
+	uint64_t hits;
+	uint64_t misses;        // generations
+	uint64_t shared_misses; // misses that waited for another caller's generation of the key
+	uint64_t evictions;
+	size_t bytes;
+	uint32_t mesh_count;
+};
+
+struct rp_cache;
+
+struct rp_cache *rp_cache_create(const struct rp_cache_desc *desc);
+void rp_cache_destroy(struct rp_cache *cache);
+// pins the mesh until rp_cache_release; NULL only if it can't be allocated
+const struct rp_mesh *rp_cache_get(struct rp_cache *cache, const struct rp_cache_key *key);
+void rp_cache_release(struct rp_cache *cache, const struct rp_mesh *mesh);
+// drops every mesh; pinned meshes are freed on their last release
+void rp_cache_invalidate(struct rp_cache *cache);
+struct rp_cache_stats rp_cache_get_stats(struct rp_cache *cache);
+
 #endif
 
@@ -0,0 +1,988 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "../../rp_gen.h"
+
+#define RP_PI32 3.14159265359f
+
+/* target amount of generated facets per measurement, so small and large meshes run for a comparable time */
+#define FACETS_PER_SAMPLE 4000000
+
+static const int32_t facet_counts[] = { 3, 8, 22, 100, 1000, 10000, 100000, 1000000 };
+#define FACET_COUNT_NUM (int32_t)(sizeof(facet_counts) / sizeof(facet_counts[0]))
+/* odd counts have no ring symmetry: above RP_SYMMETRY_CHUNK facets the ring is generated in several plain runs */
+static const int32_t odd_facet_counts[] = { 1023, 1025, 99999, 999999 };
+#define ODD_FACET_COUNT_NUM (int32_t)(sizeof(odd_facet_counts) / sizeof(odd_facet_counts[0]))
+
+static double now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+/* the original four-pass vertex generation (one sinf/cosf pair per ring), kept as a timing and accuracy baseline */
+static void ref_gen_vertices(float *vertices, int32_t facet_count, float facet_radius, float extrusion_depth) {
+	const float facet_rad = RP_PI32 * 2.0f / (float)facet_count;
+	const float ring_z[4] = { 0.0f, 0.0f, -extrusion_depth, -extrusion_depth };
+	const float ring_color[4][3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f } };
+	for (int32_t ring = 0; ring < 4; ++ring) {
+		int32_t vertex_offset = ring * facet_count * RP_VERTEX_STRIDE;
+		for (int32_t facet_idx = 0; facet_idx < facet_count; ++facet_idx) {
+			int32_t idx = facet_idx * RP_VERTEX_STRIDE + vertex_offset;
+			float rad = facet_rad * facet_idx;
+			vertices[idx + 0] = sinf(rad) * facet_radius;
+			vertices[idx + 1] = cosf(rad) * facet_radius;
+			vertices[idx + 2] = ring_z[ring];
+			vertices[idx + 3] = ring_color[ring][0];
+			vertices[idx + 4] = ring_color[ring][1];
+			vertices[idx + 5] = ring_color[ring][2];
+			vertices[idx + 6] = 1.0f;
+		}
+	}
+}
+
+/* index storage of the smallest type facet_count needs, hooked up to the matching rp_data field */
+static void *alloc_indices(int32_t facet_count) {
+	return calloc(RP_GET_INDEX_ELEMENT_COUNT((size_t)facet_count), rp_index_type_size(rp_index_type(facet_count)));
+}
+
+static void set_indices(struct rp_data *data, void *indices) {
+	const int wide = rp_index_type(data->facet_count) == RP_INDEX_TYPE_UINT32;
+	data->indices = wide ? NULL : indices;
+	data->indices32 = wide ? indices : NULL;
+}
+
+static float max_abs_error(const float *a, const float *b, size_t count) {
+	float max_err = 0.0f;
+	for (size_t i = 0; i < count; ++i) {
+		float err = fabsf(a[i] - b[i]);
+		if (err > max_err) max_err = err;
+	}
+	return max_err;
+}
+
+static void bench_trig(void) {
+	printf("rp_gen_vertices single-pass trig vs. four-pass reference\n");
+	printf("%10s %8s %14s %14s %9s %12s\n", "facets", "iters", "ref ms/iter", "gen ms/iter", "speedup", "max |err|");
+
+	for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+		const int32_t facet_count = facet_counts[n];
+		const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
+		int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+		if (iterations < 3) iterations = 3;
+
+		float *ref_vertices = calloc(vertex_element_count, sizeof(float));
+		float *vertices = calloc(vertex_element_count, sizeof(float));
+		struct rp_data data = {
+			.vertices = vertices,
+			.facet_count = facet_count,
+			.facet_radius = 2.0f,
+			.extrusion_depth = 0.3f
+		};
+
+		/* vertices only on both sides, each buffer written once untimed so neither pays its first touch */
+		ref_gen_vertices(ref_vertices, facet_count, data.facet_radius, data.extrusion_depth);
+		rp_gen_vertices(&data);
+
+		double start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			ref_gen_vertices(ref_vertices, facet_count, data.facet_radius, data.extrusion_depth);
+		}
+		double ref_ms = (now_ms() - start) / iterations;
+
+		start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen_vertices(&data);
+		}
+		double gen_ms = (now_ms() - start) / iterations;
+
+		/* the reference only writes the rings, so compare those and leave the center vertices out */
+		float err = max_abs_error(ref_vertices, vertices, (size_t)facet_count * 4 * RP_VERTEX_STRIDE);
+		printf("%10d %8d %14.5f %14.5f %8.2fx %12g\n", facet_count, iterations, ref_ms, gen_ms, ref_ms / gen_ms, err);
+
+		free(ref_vertices);
+		free(vertices);
+	}
+}
+
+static const char *kernel_names[] = { "auto", "scalar", "sse2", "avx2", "neon", "wasm-simd128" };
+
+static void bench_simd(void) {
+	printf("rp_gen vertex kernels (error measured against the scalar libm kernel, in units of facet_radius)\n");
+	printf("%10s %14s %14s %10s %12s\n", "facets", "kernel", "ms/iter", "GB/s", "max |err|/r");
+
+	const float facet_radius = 2.0f;
+	for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+		const int32_t facet_count = facet_counts[n];
+		const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
+		const size_t index_element_count = RP_GET_INDEX_ELEMENT_COUNT(facet_count);
+		int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+		if (iterations < 3) iterations = 3;
+
+		float *ref_vertices = calloc(vertex_element_count, sizeof(float));
+		float *vertices = calloc(vertex_element_count, sizeof(float));
+		void *indices = alloc_indices(facet_count);
+		struct rp_data data = {
+			.vertices = ref_vertices,
+			.facet_count = facet_count,
+			.facet_radius = facet_radius,
+			.extrusion_depth = 0.3f
+		};
+		set_indices(&data, indices);
+
+		rp_set_kernel(RP_KERNEL_SCALAR);
+		rp_gen(&data);
+		data.vertices = vertices;
+
+		for (int32_t kernel = RP_KERNEL_SCALAR; kernel <= RP_KERNEL_WASM_SIMD128; ++kernel) {
+			if (!rp_set_kernel((enum rp_kernel)kernel)) continue;
+
+			double start = now_ms();
+			for (int32_t i = 0; i < iterations; ++i) {
+				rp_gen(&data);
+			}
+			double ms = (now_ms() - start) / iterations;
+
+			double bytes = (double)vertex_element_count * sizeof(float) +
+				(double)index_element_count * rp_index_type_size(rp_index_type(facet_count));
+			float err = max_abs_error(ref_vertices, vertices, vertex_element_count) / facet_radius;
+			printf("%10d %14s %14.5f %10.2f %12g\n", facet_count, kernel_names[kernel], ms, bytes / (ms * 1.0e6), err);
+		}
+
+		free(ref_vertices);
+		free(vertices);
+		free(indices);
+	}
+	rp_set_kernel(RP_KERNEL_AUTO);
+}
+
+#define BATCH_MESH_COUNT 50000
+#define MAX_BENCH_THREADS 16
+
+static void bench_threads(void) {
+	printf("rp_gen_batch_parallel scaling, %d prisms with 3..66 facets (output compared against rp_gen_batch)\n", BATCH_MESH_COUNT);
+	printf("%8s %12s %9s %10s\n", "threads", "ms/batch", "speedup", "identical");
+
+	struct rp_data_desc *descs = calloc(BATCH_MESH_COUNT, sizeof(struct rp_data_desc));
+	for (int32_t i = 0; i < BATCH_MESH_COUNT; ++i) {
+		descs[i] = (struct rp_data_desc){
+			.facet_count = 3 + i % 64,
+			.facet_radius = 1.0f + (float)(i % 7),
+			.extrusion_depth = 0.1f + (float)(i % 5)
+		};
+	}
+	size_t vertex_element_count, index_element_count;
+	rp_batch_size(descs, BATCH_MESH_COUNT, &vertex_element_count, &index_element_count);
+
+	struct rp_batch ref = {
+		.vertices = calloc(vertex_element_count, sizeof(float)),
+		.indices = calloc(index_element_count, sizeof(uint16_t)),
+		.ranges = calloc(BATCH_MESH_COUNT, sizeof(struct rp_mesh_range))
+	};
+	struct rp_batch batch = {
+		.vertices = calloc(vertex_element_count, sizeof(float)),
+		.indices = calloc(index_element_count, sizeof(uint16_t)),
+		.ranges = calloc(BATCH_MESH_COUNT, sizeof(struct rp_mesh_range))
+	};
+
+	const int32_t iterations = 10;
+	double start = now_ms();
+	for (int32_t i = 0; i < iterations; ++i) {
+		rp_gen_batch(descs, BATCH_MESH_COUNT, &ref);
+	}
+	double serial_ms = (now_ms() - start) / iterations;
+	printf("%8s %12.3f %8.2fx %10s\n", "serial", serial_ms, 1.0, "-");
+
+	for (uint32_t thread_count = 1; thread_count <= MAX_BENCH_THREADS; thread_count *= 2) {
+		struct rp_thread_pool *pool = rp_thread_pool_create(&(struct rp_thread_pool_desc){ .thread_count = thread_count });
+		struct rp_job_system jobs = rp_thread_pool_job_system(pool);
+
+		memset(batch.vertices, 0, vertex_element_count * sizeof(float));
+		start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen_batch_parallel(descs, BATCH_MESH_COUNT, &batch, &jobs);
+		}
+		double ms = (now_ms() - start) / iterations;
+
+		int identical = !memcmp(ref.vertices, batch.vertices, vertex_element_count * sizeof(float)) &&
+			!memcmp(ref.indices, batch.indices, index_element_count * sizeof(uint16_t)) &&
+			!memcmp(ref.ranges, batch.ranges, BATCH_MESH_COUNT * sizeof(struct rp_mesh_range));
+		printf("%8u %12.3f %8.2fx %10s\n", rp_thread_pool_thread_count(pool), ms, serial_ms / ms, identical ? "yes" : "NO");
+		rp_thread_pool_destroy(pool);
+	}
+
+	free(ref.vertices);
+	free(ref.indices);
+	free(ref.ranges);
+	free(batch.vertices);
+	free(batch.indices);
+	free(batch.ranges);
+	free(descs);
+}
+
+#define RANGE_FACET_COUNT 2000000
+
+static void bench_range(void) {
+	printf("rp_gen_parallel scaling, one prism with %d facets (output compared against rp_gen)\n", RANGE_FACET_COUNT);
+	printf("%8s %12s %9s %10s\n", "threads", "ms/mesh", "speedup", "identical");
+
+	const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT((size_t)RANGE_FACET_COUNT);
+	const size_t index_element_count = RP_GET_INDEX_ELEMENT_COUNT((size_t)RANGE_FACET_COUNT);
+	struct rp_data ref = {
+		.vertices = calloc(vertex_element_count, sizeof(float)),
+		.indices32 = calloc(index_element_count, sizeof(uint32_t)),
+		.facet_count = RANGE_FACET_COUNT,
+		.facet_radius = 2.0f,
+		.extrusion_depth = 0.3f
+	};
+	struct rp_data data = ref;
+	data.vertices = calloc(vertex_element_count, sizeof(float));
+	data.indices32 = calloc(index_element_count, sizeof(uint32_t));
+
+	const int32_t iterations = 5;
+	double start = now_ms();
+	for (int32_t i = 0; i < iterations; ++i) {
+		rp_gen(&ref);
+	}
+	double serial_ms = (now_ms() - start) / iterations;
+	printf("%8s %12.3f %8.2fx %10s\n", "serial", serial_ms, 1.0, "-");
+
+	for (uint32_t thread_count = 1; thread_count <= MAX_BENCH_THREADS; thread_count *= 2) {
+		struct rp_thread_pool *pool = rp_thread_pool_create(&(struct rp_thread_pool_desc){ .thread_count = thread_count });
+		struct rp_job_system jobs = rp_thread_pool_job_system(pool);
+
+		memset(data.vertices, 0, vertex_element_count * sizeof(float));
+		start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen_parallel(&data, &jobs);
+		}
+		double ms = (now_ms() - start) / iterations;
+
+		int identical = !memcmp(ref.vertices, data.vertices, vertex_element_count * sizeof(float)) &&
+			!memcmp(ref.indices32, data.indices32, index_element_count * sizeof(uint32_t));
+		printf("%8u %12.3f %8.2fx %10s\n", rp_thread_pool_thread_count(pool), ms, serial_ms / ms, identical ? "yes" : "NO");
+		rp_thread_pool_destroy(pool);
+	}
+
+	free(ref.vertices);
+	free(ref.indices32);
+	free(data.vertices);
+	free(data.indices32);
+}
+
+static void bench_soa(void) {
+	printf("interleaved vs. structure of arrays output (index generation included in every column)\n");
+	printf("%10s %14s %14s %14s %12s %10s\n", "facets", "interleaved ms", "soa xyz ms", "soa xyz+rgba", "xyz bytes", "identical");
+
+	for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+		const int32_t facet_count = facet_counts[n];
+		const size_t vertex_count = (size_t)facet_count * 4 + 2;
+		const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
+		int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+		if (iterations < 3) iterations = 3;
+
+		float *vertices = calloc(vertex_element_count, sizeof(float));
+		void *indices = alloc_indices(facet_count);
+		struct rp_soa soa = {
+			.x = calloc(vertex_count, sizeof(float)),
+			.y = calloc(vertex_count, sizeof(float)),
+			.z = calloc(vertex_count, sizeof(float))
+		};
+		float *colors = calloc(vertex_count * 4, sizeof(float));
+
+		struct rp_data data = {
+			.vertices = vertices,
+			.facet_count = facet_count,
+			.facet_radius = 2.0f,
+			.extrusion_depth = 0.3f
+		};
+		set_indices(&data, indices);
+		double start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen(&data);
+		}
+		double interleaved_ms = (now_ms() - start) / iterations;
+
+		data.soa = &soa;
+		start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen(&data);
+		}
+		double soa_ms = (now_ms() - start) / iterations;
+
+		int identical = 1;
+		for (size_t v = 0; v < vertex_count; ++v) {
+			const float *vertex = &vertices[v * RP_VERTEX_STRIDE];
+			identical &= vertex[0] == soa.x[v] && vertex[1] == soa.y[v] && vertex[2] == soa.z[v];
+		}
+
+		soa.colors = colors;
+		start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen(&data);
+		}
+		double soa_color_ms = (now_ms() - start) / iterations;
+
+		printf("%10d %14.5f %14.5f %14.5f %11.0f%% %10s\n", facet_count, interleaved_ms, soa_ms, soa_color_ms,
+			100.0 * 3.0 / RP_VERTEX_STRIDE, identical ? "yes" : "NO");
+
+		free(vertices);
+		free(indices);
+		free(soa.x);
+		free(soa.y);
+		free(soa.z);
+		free(colors);
+	}
+}
+
+/* largest distance of the ring positions from the exact circle, and the facets whose mirror i -> n - i isn't exact */
+static void ring_error(const float *vertices, int32_t facet_count, float facet_radius, double *max_err, int32_t *asymmetric) {
+	*max_err = 0.0;
+	*asymmetric = 0;
+	for (int32_t i = 0; i < facet_count; ++i) {
+		const double rad = 2.0 * 3.14159265358979323846 * (double)i / (double)facet_count;
+		const float *vertex = &vertices[i * RP_VERTEX_STRIDE];
+		const double err_x = fabs(vertex[0] - facet_radius * sin(rad));
+		const double err_y = fabs(vertex[1] - facet_radius * cos(rad));
+		if (err_x > *max_err) *max_err = err_x;
+		if (err_y > *max_err) *max_err = err_y;
+		const float *mirror = &vertices[((facet_count - i) % facet_count) * RP_VERTEX_STRIDE];
+		if (i > 0 && (mirror[0] != -vertex[0] || mirror[1] != vertex[1])) ++*asymmetric;
+	}
+}
+
+static void bench_symmetry(void) {
+	static const enum rp_kernel kernels[] = { RP_KERNEL_SCALAR, RP_KERNEL_AUTO };
+
+	printf("symmetric ring generation (even facet counts) vs. the odd count fallback and the four-pass reference\n");
+	printf("error against the exact circle in units of facet_radius; asym = facets whose mirror image isn't exact\n");
+	printf("%7s %10s %10s %12s %12s %8s %12s %6s\n", "kernel", "facets", "ref ms", "rp_gen ms", "ref |err|", "speedup",
+		"rp_gen |err|", "asym");
+
+	for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k) {
+		rp_set_kernel(kernels[k]);
+		for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+			/* every even count next to the odd count right above it */
+			for (int32_t odd = 0; odd < 2; ++odd) {
+				const int32_t facet_count = facet_counts[n] + odd;
+				if (facet_count % 2 != odd) continue;
+				const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count);
+				int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+				if (iterations < 3) iterations = 3;
+
+				float *ref_vertices = calloc(vertex_element_count, sizeof(float));
+				float *vertices = calloc(vertex_element_count, sizeof(float));
+				void *indices = alloc_indices(facet_count);
+				struct rp_data data = {
+					.vertices = vertices,
+					.facet_count = facet_count,
+					.facet_radius = 2.0f,
+					.extrusion_depth = 0.3f
+				};
+				set_indices(&data, indices);
+
+				double start = now_ms();
+				for (int32_t i = 0; i < iterations; ++i) {
+					ref_gen_vertices(ref_vertices, facet_count, data.facet_radius, data.extrusion_depth);
+				}
+				double ref_ms = (now_ms() - start) / iterations;
+
+				start = now_ms();
+				for (int32_t i = 0; i < iterations; ++i) {
+					rp_gen(&data);
+				}
+				double gen_ms = (now_ms() - start) / iterations;
+
+				double ref_err, gen_err;
+				int32_t ref_asymmetric, gen_asymmetric;
+				ring_error(ref_vertices, facet_count, data.facet_radius, &ref_err, &ref_asymmetric);
+				ring_error(vertices, facet_count, data.facet_radius, &gen_err, &gen_asymmetric);
+				(void)ref_asymmetric;
+				printf("%7s %10d %10.5f %12.5f %12g %7.2fx %12g %6d\n", kernels[k] == RP_KERNEL_SCALAR ? "scalar" : "auto",
+					facet_count, ref_ms, gen_ms, ref_err / data.facet_radius, ref_ms / gen_ms, gen_err / data.facet_radius,
+					gen_asymmetric);
+
+				free(ref_vertices);
+				free(vertices);
+				free(indices);
+			}
+		}
+	}
+	rp_set_kernel(RP_KERNEL_AUTO);
+}
+
+static const char *precision_names[] = { "fast", "exact", "coarse" };
+
+/* one row per tier; "cached" compares the output against rp_gen with a table cache, which must be bit-identical */
+static void precision_rows(int32_t facet_count, struct rp_table_cache *cache) {
+	const float facet_radius = 2.0f;
+	const float radius_ulp = nextafterf(facet_radius, 4.0f) - facet_radius;
+	const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count);
+	int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+	if (iterations < 3) iterations = 3;
+
+	float *exact_vertices = calloc(vertex_element_count, sizeof(float));
+	float *vertices = calloc(vertex_element_count, sizeof(float));
+	float *cached_vertices = calloc(vertex_element_count, sizeof(float));
+	void *indices = alloc_indices(facet_count);
+	struct rp_data data = {
+		.vertices = exact_vertices,
+		.facet_count = facet_count,
+		.facet_radius = facet_radius,
+		.extrusion_depth = 0.3f,
+		.precision = RP_PRECISION_EXACT
+	};
+	set_indices(&data, indices);
+	rp_gen(&data);
+
+	for (int32_t precision = RP_PRECISION_FAST; precision <= RP_PRECISION_COARSE; ++precision) {
+		data.precision = (enum rp_precision)precision;
+		data.vertices = vertices;
+		data.table_cache = NULL;
+		/* untimed first call: whichever tier ran first would otherwise pay for faulting in the pages */
+		rp_gen(&data);
+		double start = now_ms();
+		for (int32_t i = 0; i < iterations; ++i) {
+			rp_gen(&data);
+		}
+		double ms = (now_ms() - start) / iterations;
+
+		data.vertices = cached_vertices;
+		data.table_cache = cache;
+		rp_gen(&data);
+		const int identical = !memcmp(vertices, cached_vertices, vertex_element_count * sizeof(float));
+
+		double circle_err;
+		int32_t asymmetric;
+		ring_error(vertices, facet_count, facet_radius, &circle_err, &asymmetric);
+		const float exact_err = max_abs_error(exact_vertices, vertices, (size_t)facet_count * 4 * RP_VERTEX_STRIDE);
+		printf("%10d %8s %12.5f %14g %14g %10.2f %8s\n", facet_count, precision_names[precision], ms,
+			circle_err / facet_radius, exact_err / facet_radius, exact_err / radius_ulp, identical ? "yes" : "NO");
+	}
+
+	free(exact_vertices);
+	free(vertices);
+	free(cached_vertices);
+	free(indices);
+}
+
+static void bench_precision(void) {
+	printf("precision tiers: rp_gen time, error against the exact circle and against the exact tier (units of facet_radius)\n");
+	printf("%10s %8s %12s %14s %14s %10s %8s\n", "facets", "tier", "ms", "circle |err|", "vs exact", "ulp of r", "cached");
+
+	struct rp_table_cache *cache = rp_table_cache_create(&(struct rp_table_cache_desc){ .byte_budget = 64u << 20 });
+	for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+		precision_rows(facet_counts[n], cache);
+	}
+	for (int32_t n = 0; n < ODD_FACET_COUNT_NUM; ++n) {
+		precision_rows(odd_facet_counts[n], cache);
+	}
+	rp_table_cache_destroy(cache);
+
+	/* the coarse bound documented in rp_gen.h, over every facet count up to 3000 and a sample up to 20000 */
+	const double coarse_bound = 1e-5;
+	float *vertices = calloc(RP_GET_VERTEX_ELEMENT_COUNT((size_t)20000), sizeof(float));
+	double worst_err = 0.0;
+	int32_t worst_facet_count = 0;
+	for (int32_t facet_count = 3; facet_count <= 20000; facet_count += facet_count < 3000 ? 1 : 37) {
+		rp_gen_vertices(&(struct rp_data){
+			.vertices = vertices,
+			.facet_count = facet_count,
+			.facet_radius = 1.0f,
+			.extrusion_depth = 0.3f,
+			.precision = RP_PRECISION_COARSE
+		});
+		double circle_err;
+		int32_t asymmetric;
+		ring_error(vertices, facet_count, 1.0f, &circle_err, &asymmetric);
+		if (circle_err > worst_err) {
+			worst_err = circle_err;
+			worst_facet_count = facet_count;
+		}
+	}
+	printf("coarse worst circle |err| %g at %d facets, below %g: %s\n", worst_err, worst_facet_count, coarse_bound,
+		worst_err < coarse_bound ? "yes" : "NO");
+	free(vertices);
+}
+
+static const char *topology_names[] = { "triangles", "strip restart", "strip degenerate" };
+
+static void bench_topology(void) {
+	printf("index count, index bytes and rp_gen time per topology\n");
+	printf("%10s %18s %12s %14s %12s\n", "facets", "topology", "indices", "index bytes", "ms");
+
+	for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+		const int32_t facet_count = facet_counts[n];
+		int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+		if (iterations < 3) iterations = 3;
+
+		/* the triangle list is the largest topology */
+		float *vertices = calloc(RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count), sizeof(float));
+		void *indices = alloc_indices(facet_count);
+		const size_t index_size = rp_index_type_size(rp_index_type(facet_count));
+
+		for (int32_t topology = RP_TOPOLOGY_TRIANGLES; topology <= RP_TOPOLOGY_STRIP_DEGENERATE; ++topology) {
+			struct rp_data data = {
+				.vertices = vertices,
+				.facet_count = facet_count,
+				.facet_radius = 2.0f,
+				.extrusion_depth = 0.3f,
+				.topology = (enum rp_topology)topology
+			};
+			set_indices(&data, indices);
+			double start = now_ms();
+			for (int32_t i = 0; i < iterations; ++i) {
+				rp_gen(&data);
+			}
+			double ms = (now_ms() - start) / iterations;
+
+			const size_t index_count = rp_index_count(facet_count, (enum rp_topology)topology);
+			printf("%10d %18s %12zu %14zu %12.5f\n", facet_count, topology_names[topology], index_count,
+				index_count * index_size, ms);
+		}
+
+		free(vertices);
+		free(indices);
+	}
+}
+
+static void cache_row(struct rp_table_cache *cache, int32_t facet_count, enum rp_precision precision) {
+	const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count);
+	int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+	if (iterations < 3) iterations = 3;
+
+	float *vertices = calloc(vertex_element_count, sizeof(float));
+	float *cached_vertices = calloc(vertex_element_count, sizeof(float));
+	void *indices = alloc_indices(facet_count);
+	struct rp_data data = { .facet_count = facet_count, .precision = precision };
+	set_indices(&data, indices);
+
+	double uncached_ms = 0.0;
+	double cached_ms = 0.0;
+	int identical = 1;
+	const struct rp_table_cache_stats before = rp_table_cache_get_stats(cache);
+	for (int32_t i = 0; i < iterations; ++i) {
+		data.facet_radius = 1.0f + 0.01f * (float)(i % 100);
+		data.extrusion_depth = 0.3f + 0.01f * (float)(i % 50);
+
+		data.vertices = vertices;
+		data.table_cache = NULL;
+		double start = now_ms();
+		rp_gen(&data);
+		uncached_ms += now_ms() - start;
+
+		data.vertices = cached_vertices;
+		data.table_cache = cache;
+		start = now_ms();
+		rp_gen(&data);
+		cached_ms += now_ms() - start;
+
+		identical &= !memcmp(vertices, cached_vertices, vertex_element_count * sizeof(float));
+	}
+	const struct rp_table_cache_stats after = rp_table_cache_get_stats(cache);
+
+	printf("%10d %8s %12.5f %12.5f %10llu %10llu %10s\n", facet_count, precision_names[precision],
+		uncached_ms / iterations, cached_ms / iterations, (unsigned long long)(after.hits - before.hits),
+		(unsigned long long)(after.misses - before.misses), identical ? "yes" : "NO");
+
+	free(vertices);
+	free(cached_vertices);
+	free(indices);
+}
+
+static void bench_cache(void) {
+	printf("rp_gen with and without the facet table cache of unit circles and index patterns (radius and depth change every call)\n");
+	printf("%10s %8s %12s %12s %10s %10s %10s\n", "facets", "tier", "uncached ms", "cached ms", "hits", "misses",
+		"identical");
+
+	/* coarse tables come from the same runs as uncached coarse output, odd counts included */
+	static const enum rp_precision precisions[] = { RP_PRECISION_FAST, RP_PRECISION_COARSE };
+	struct rp_table_cache *cache = rp_table_cache_create(&(struct rp_table_cache_desc){ .byte_budget = 64u << 20 });
+	for (int32_t p = 0; p < 2; ++p) {
+		for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+			cache_row(cache, facet_counts[n], precisions[p]);
+		}
+		for (int32_t n = 0; n < ODD_FACET_COUNT_NUM; ++n) {
+			cache_row(cache, odd_facet_counts[n], precisions[p]);
+		}
+	}
+
+	const struct rp_table_cache_stats stats = rp_table_cache_get_stats(cache);
+	printf("cache: %u tables, %zu bytes, %llu evictions\n", stats.table_count, stats.bytes,
+		(unsigned long long)stats.evictions);
+	rp_table_cache_destroy(cache);
+
+	/* coarse tables are shared by every kernel, so a table built under one kernel must match uncached output under another */
+	cache = rp_table_cache_create(&(struct rp_table_cache_desc){ .byte_budget = 64u << 20 });
+	const int32_t facet_count = 99999;
+	const size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count);
+	float *vertices = calloc(vertex_element_count, sizeof(float));
+	float *cached_vertices = calloc(vertex_element_count, sizeof(float));
+	int identical = 1;
+	for (int32_t kernel = RP_KERNEL_SCALAR; kernel <= RP_KERNEL_WASM_SIMD128; ++kernel) {
+		if (!rp_set_kernel((enum rp_kernel)kernel)) continue;
+		struct rp_data data = {
+			.vertices = vertices,
+			.facet_count = facet_count,
+			.facet_radius = 2.0f,
+			.extrusion_depth = 0.3f,
+			.precision = RP_PRECISION_COARSE
+		};
+		rp_gen_vertices(&data);
+		data.vertices = cached_vertices;
+		data.table_cache = cache;
+		rp_gen_vertices(&data);
+		identical &= !memcmp(vertices, cached_vertices, vertex_element_count * sizeof(float));
+	}
+	rp_set_kernel(RP_KERNEL_AUTO);
+	printf("coarse tables across kernel switches: identical %s\n", identical ? "yes" : "NO");
+	free(vertices);
+	free(cached_vertices);
+	rp_table_cache_destroy(cache);
+}
+
+static void bench_mesh_cache(void) {
+	printf("requests for repeating (facet_count, radius, depth) keys: rp_gen into fresh blocks against rp_cache_get\n");
+	printf("%10s %10s %12s %12s %10s %10s %10s\n", "keys", "requests", "rp_gen ms", "cache ms", "hits", "misses",
+		"evictions");
+
+	const int32_t key_counts[] = { 16, 256, 4096 };
+	const int32_t request_count = 100000;
+	for (int32_t k = 0; k < (int32_t)(sizeof(key_counts) / sizeof(key_counts[0])); ++k) {
+		struct rp_cache *cache = rp_cache_create(&(struct rp_cache_desc){ .byte_budget = 4u << 20 });
+		double gen_ms = 0.0;
+		double cache_ms = 0.0;
+		uint32_t seed = 1;
+		for (int32_t i = 0; i < request_count; ++i) {
+			/* squaring a uniform pick skews requests towards the low keys */
+			seed = seed * 1664525u + 1013904223u;
+			const double pick = (double)(seed >> 8) / (double)(1u << 24);
+			const int32_t key = (int32_t)(pick * pick * key_counts[k]);
+			const struct rp_cache_key desc = {
+				.facet_count = 8 + key % 64,
+				.facet_radius = 1.0f + 0.25f * (float)(key / 64 % 8),
+				.extrusion_depth = 0.5f + 0.5f * (float)(key / 512)
+			};
+
+			double start = now_ms();
+			float *vertices = malloc(RP_GET_VERTEX_ELEMENT_COUNT((size_t)desc.facet_count) * sizeof(float));
+			uint16_t *indices = malloc(RP_GET_INDEX_ELEMENT_COUNT((size_t)desc.facet_count) * sizeof(uint16_t));
+			rp_gen(&(struct rp_data){
+				.vertices = vertices,
+				.indices = indices,
+				.facet_count = desc.facet_count,
+				.facet_radius = desc.facet_radius,
+				.extrusion_depth = desc.extrusion_depth
+			});
+			free(vertices);
+			free(indices);
+			gen_ms += now_ms() - start;
+
+			start = now_ms();
+			const struct rp_mesh *mesh = rp_cache_get(cache, &desc);
+			rp_cache_release(cache, mesh);
+			cache_ms += now_ms() - start;
+		}
+
+		const struct rp_cache_stats stats = rp_cache_get_stats(cache);
+		printf("%10d %10d %12.3f %12.3f %10llu %10llu %10llu\n", key_counts[k], request_count, gen_ms, cache_ms,
+			(unsigned long long)stats.hits, (unsigned long long)stats.misses, (unsigned long long)stats.evictions);
+		rp_cache_destroy(cache);
+	}
+}
+
+#define CONTENTION_KEYS 256
+#define CONTENTION_REQUESTS 200000
+
+struct contention_worker {
+	struct rp_cache *cache;
+	pthread_barrier_t *start;
+	uint32_t seed;
+	int32_t facet_count; /* 0: skewed picks from CONTENTION_KEYS keys, else every request asks for this mesh */
+};
+
+static void *contention_main(void *arg) {
+	struct contention_worker *worker = arg;
+	pthread_barrier_wait(worker->start);
+	const int32_t request_count = worker->facet_count ? 1 : CONTENTION_REQUESTS;
+	uint32_t seed = worker->seed;
+	for (int32_t i = 0; i < request_count; ++i) {
+		seed = seed * 1664525u + 1013904223u;
+		const double pick = (double)(seed >> 8) / (double)(1u << 24);
+		const int32_t key = (int32_t)(pick * pick * CONTENTION_KEYS);
+		const struct rp_cache_key desc = {
+			.facet_count = worker->facet_count ? worker->facet_count : 8 + key % 32,
+			.facet_radius = 1.0f + 0.5f * (float)(key / 32),
+			.extrusion_depth = 1.0f
+		};
+		const struct rp_mesh *mesh = rp_cache_get(worker->cache, &desc);
+		rp_cache_release(worker->cache, mesh);
+	}
+	return NULL;
+}
+
+/* runs thread_count workers against the cache, returns the wall time in ms */
+static double run_contention(struct rp_cache *cache, uint32_t thread_count, int32_t facet_count) {
+	pthread_t threads[MAX_BENCH_THREADS];
+	struct contention_worker workers[MAX_BENCH_THREADS];
+	pthread_barrier_t start;
+	pthread_barrier_init(&start, NULL, thread_count + 1);
+	for (uint32_t i = 0; i < thread_count; ++i) {
+		workers[i] = (struct contention_worker){
+			.cache = cache,
+			.start = &start,
+			.seed = i + 1,
+			.facet_count = facet_count
+		};
+		pthread_create(&threads[i], NULL, contention_main, &workers[i]);
+	}
+	pthread_barrier_wait(&start);
+	const double begin = now_ms();
+	for (uint32_t i = 0; i < thread_count; ++i) {
+		pthread_join(threads[i], NULL);
+	}
+	const double ms = now_ms() - begin;
+	pthread_barrier_destroy(&start);
+	return ms;
+}
+
+static void bench_contention(void) {
+	printf("rp_cache_get + rp_cache_release from many threads, %d requests per thread over %d skewed keys\n",
+		CONTENTION_REQUESTS, CONTENTION_KEYS);
+	printf("%8s %8s %10s %12s %10s %10s %10s\n", "shards", "threads", "budget", "Mreq/s", "hits", "misses", "shared");
+
+	const uint32_t shard_counts[] = { 1, 16 };
+	const size_t budgets[] = { 64u << 20, 256u << 10 }; /* everything fits / constant eviction */
+	for (int32_t s = 0; s < 2; ++s) {
+		for (int32_t b = 0; b < 2; ++b) {
+			for (uint32_t thread_count = 1; thread_count <= MAX_BENCH_THREADS; thread_count *= 2) {
+				struct rp_cache *cache = rp_cache_create(&(struct rp_cache_desc){
+					.byte_budget = budgets[b],
+					.shard_count = shard_counts[s]
+				});
+				const double ms = run_contention(cache, thread_count, 0);
+				const struct rp_cache_stats stats = rp_cache_get_stats(cache);
+				printf("%8u %8u %9zuK %12.2f %10llu %10llu %10llu\n", shard_counts[s], thread_count, budgets[b] >> 10,
+					(double)thread_count * CONTENTION_REQUESTS / ms / 1000.0, (unsigned long long)stats.hits,
+					(unsigned long long)stats.misses, (unsigned long long)stats.shared_misses);
+				rp_cache_destroy(cache);
+			}
+		}
+	}
+
+	printf("cold start: %d threads ask for the same 1000000 facet prism at once\n", MAX_BENCH_THREADS);
+	struct rp_cache *cache = rp_cache_create(&(struct rp_cache_desc){ .byte_budget = 256u << 20 });
+	const double ms = run_contention(cache, MAX_BENCH_THREADS, 1000000);
+	const struct rp_cache_stats stats = rp_cache_get_stats(cache);
+	printf("%.3f ms, %llu generation(s), %llu waiters\n", ms, (unsigned long long)stats.misses,
+		(unsigned long long)stats.shared_misses);
+	rp_cache_destroy(cache);
+}
+
+static const char *update_names[] = { "depth", "radius", "colors" };
+
+static void bench_update(void) {
+	printf("parameter edits: rp_gen_vertices against the rp_update_* call for the edit on the same vertex block\n");
+	printf("%8s %10s %12s %12s %10s %14s %10s\n", "edit", "facets", "regen ms", "update ms", "speedup", "dirty bytes",
+		"identical");
+
+	static const float palettes[2][12] = {
+		{ 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f },
+		{ 0.9f, 0.5f, 0.1f, 0.2f, 0.2f, 0.2f, 0.1f, 0.5f, 0.9f, 0.2f, 0.2f, 0.2f }
+	};
+	for (int32_t edit = 0; edit < 3; ++edit) {
+		for (int32_t n = 0; n < FACET_COUNT_NUM; ++n) {
+			const int32_t facet_count = facet_counts[n];
+			const size_t vertex_bytes = RP_GET_VERTEX_ELEMENT_COUNT((size_t)facet_count) * sizeof(float);
+			int32_t iterations = FACETS_PER_SAMPLE / facet_count;
+			if (iterations < 3) iterations = 3;
+
+			float *vertices = calloc(vertex_bytes, 1);
+			float *updated = calloc(vertex_bytes, 1);
+			struct rp_data data = { .facet_count = facet_count, .facet_radius = 2.0f, .extrusion_depth = 1.0f };
+			data.vertices = updated;
+			rp_gen_vertices(&data);
+
+			double regen_ms = 0.0;
+			double update_ms = 0.0;
+			size_t dirty_bytes = 0;
+			for (int32_t i = 0; i < iterations; ++i) {
+				if (edit == 0) data.extrusion_depth = 0.3f + 0.01f * (float)(i % 50);
+				if (edit == 1) data.facet_radius = 1.0f + 0.01f * (float)(i % 100);
+				if (edit == 2) data.ring_colors = palettes[i % 2];
+
+				data.vertices = vertices;
+				double start = now_ms();
+				rp_gen_vertices(&data);
+				regen_ms += now_ms() - start;
+
+				struct rp_dirty_ranges dirty;
+				data.vertices = updated;
+				start = now_ms();
+				if (edit == 0) rp_update_depth(&data, &dirty);
+				if (edit == 1) rp_update_radius(&data, &dirty);
+				if (edit == 2) rp_update_colors(&data, &dirty);
+				update_ms += now_ms() - start;
+
+				dirty_bytes = 0;
+				for (uint32_t r = 0; r < dirty.count; ++r) dirty_bytes += dirty.ranges[r].size;
+			}
+
+			printf("%8s %10d %12.5f %12.5f %9.2fx %14zu %10s\n", update_names[edit], facet_count, regen_ms / iterations,
+				update_ms / iterations, regen_ms / update_ms, dirty_bytes,
+				!memcmp(vertices, updated, vertex_bytes) ? "yes" : "NO");
+
+			free(vertices);
+			free(updated);
+		}
+	}
+}
+
+/* fnv-1a over a byte stream, standing in for an exporter that consumes the chunks */
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+	const uint8_t *bytes = data;
+	for (size_t i = 0; i < size; ++i) {
+		hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+	}
+	return hash;
+}
+
+#define STREAM_CHUNK_BYTES (64 * 1024)
+
+static void bench_stream(void) {
+	static const int32_t stream_facet_counts[] = { 10000, 100000, 1000000, 20000000 };
+	/* above this, only the streamed mesh is produced: the whole blocks would not be allocated */
+	const int32_t max_whole_facets = 1000000;
+
+	printf("streaming: rp_gen into whole blocks against a generator writing %d KiB chunks, both hashed\n",
+		STREAM_CHUNK_BYTES / 1024);
+	printf("%10s %12s %14s %12s %14s %10s\n", "facets", "rp_gen ms", "block bytes", "stream ms", "stream bytes",
+		"identical");
+
+	static uint8_t chunk[STREAM_CHUNK_BYTES];
+	for (size_t n = 0; n < sizeof(stream_facet_counts) / sizeof(stream_facet_counts[0]); ++n) {
+		const int32_t facet_count = stream_facet_counts[n];
+		struct rp_data data = { .facet_count = facet_count, .facet_radius = 2.0f, .extrusion_depth = 1.0f };
+
+		double whole_ms = 0.0;
+		size_t block_bytes = 0;
+		uint64_t whole_hash = 0;
+		if (facet_count <= max_whole_facets) {
+			const size_t vertex_bytes = rp_vertex_buffer_size(facet_count, NULL);
+			const size_t index_bytes = rp_index_count(facet_count, RP_TOPOLOGY_TRIANGLES) *
+				rp_index_type_size(rp_index_type(facet_count));
+			data.vertices = malloc(vertex_bytes);
+			void *indices = malloc(index_bytes);
+			set_indices(&data, indices);
+
+			double start = now_ms();
+			rp_gen(&data);
+			whole_hash = fnv1a(fnv1a(0xcbf29ce484222325ull, data.vertices, vertex_bytes), indices, index_bytes);
+			whole_ms = now_ms() - start;
+			block_bytes = vertex_bytes + index_bytes;
+
+			free(data.vertices);
+			free(indices);
+		}
+
+		struct rp_generator gen;
+		rp_generator_init(&gen, &data);
+		double start = now_ms();
+		uint64_t stream_hash = 0xcbf29ce484222325ull;
+		size_t bytes;
+		while ((bytes = rp_generator_write_vertices(&gen, chunk, sizeof(chunk))) != 0) {
+			stream_hash = fnv1a(stream_hash, chunk, bytes);
+		}
+		while ((bytes = rp_generator_write_indices(&gen, chunk, sizeof(chunk))) != 0) {
+			stream_hash = fnv1a(stream_hash, chunk, bytes);
+		}
+		const double stream_ms = now_ms() - start;
+
+		if (block_bytes) {
+			printf("%10d %12.3f %14zu %12.3f %14zu %10s\n", facet_count, whole_ms, block_bytes, stream_ms, sizeof(chunk),
+				whole_hash == stream_hash ? "yes" : "NO");
+		} else {
+			printf("%10d %12s %14s %12.3f %14zu %10s\n", facet_count, "-", "-", stream_ms, sizeof(chunk), "-");
+		}
+	}
+}
+
+int main(int argc, char *argv[]) {
+	const char *mode = argc > 1 ? argv[1] : "all";
+	int ran = 0;
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "trig")) {
+		bench_trig();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "simd")) {
+		bench_simd();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "threads")) {
+		bench_threads();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "range")) {
+		bench_range();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "soa")) {
+		bench_soa();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "topology")) {
+		bench_topology();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "precision")) {
+		bench_precision();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "symmetry")) {
+		bench_symmetry();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "cache")) {
+		bench_cache();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "meshcache")) {
+		bench_mesh_cache();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "contention")) {
+		bench_contention();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "update")) {
+		bench_update();
+		ran = 1;
+	}
+
+	if (!strcmp(mode, "all") || !strcmp(mode, "stream")) {
+		bench_stream();
+		ran = 1;
+	}
+
+	if (!ran) {
+		fprintf(stderr, "usage: %s [all|trig|simd|threads|range|soa|topology|cache|symmetry|precision|meshcache|contention|update|stream]\n", argv[0]);
+		return 1;
+	}
+	return 0;
+}
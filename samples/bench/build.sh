@@ -0,0 +1,7 @@
+#!/bin/sh
+
+set -eu
+
+gcc -O2 bench.c ../../rp_gen.c \
+	-lm -pthread \
+	-o bench
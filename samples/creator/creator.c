@@ -20,40 +20,60 @@ static sg_pipeline pip;
 static sg_bindings bindings;
 static sg_buffer vbufs[MESH_COUNT];
 static sg_buffer ibufs[MESH_COUNT];
+/* every regeneration reuses the unit circles */
+static struct rp_table_cache *table_cache;
+/*
+	the table cache allocates itself and one unit circle per facet count, each fits a block: an evicted circle's block
+	goes back to the pool instead of leaking as it would in an arena
+*/
+#define TABLE_BLOCK_SIZE 512
+static _Alignas(RP_FIXED_POOL_ALIGNMENT) uint8_t table_memory[(MESH_COUNT + 1) * TABLE_BLOCK_SIZE];
+static struct rp_fixed_pool table_pool;
+/* vertex refreshes and index builds generate into scratch, upload from there and reset it */
+static _Alignas(64) uint8_t scratch_memory[4 * 1024];
+static struct rp_arena scratch_arena;
+
+/* unit prisms: the shader scales xy by the radius uniform and moves back vertices to -depth */
+#define VERTEX_STRIDE 32
+static const struct rp_vertex_layout unit_prism_layout = {
+	.attrs = {
+		[RP_ATTR_POSITION] = { RP_FORMAT_F32, 0, VERTEX_STRIDE },
+		[RP_ATTR_COLOR] = { RP_FORMAT_F32, 12, VERTEX_STRIDE },
+		[RP_ATTR_BACK] = { RP_FORMAT_F32, 28, VERTEX_STRIDE }
+	}
+};
+
+/* ring colors (front facet, front edge, back facet, back edge), the one parameter still baked into the vertices */
+static const float palettes[][12] = {
+	{ 1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 1.0f,  0.0f, 1.0f, 0.0f },
+	{ 1.0f, 0.6f, 0.1f,  0.9f, 0.9f, 0.9f,  0.5f, 0.1f, 0.6f,  0.9f, 0.9f, 0.9f },
+	{ 0.2f, 0.8f, 0.8f,  0.1f, 0.3f, 0.4f,  0.9f, 0.8f, 0.2f,  0.1f, 0.3f, 0.4f }
+};
+#define PALETTE_COUNT ((int32_t)(sizeof(palettes) / sizeof(palettes[0])))
 
 static float rx, ry;
 static int32_t g_facet_count = MIN_FACET_COUNT;
 static float g_depth = MIN_DEPTH;
+static float g_radius = 2.0f;
+static int32_t g_palette;
+/* the palette each vertex buffer holds, -1 until its first upload */
+static int32_t mesh_palettes[MESH_COUNT];
 
-static void gen_polygon_buffers(void) {
+/* index patterns only depend on the facet count: generated once, kept across depth changes */
+static void gen_index_buffers(void) {
 	for (int32_t i = 0; i < MESH_COUNT; ++i) {
 		int32_t facet_count = i + MIN_FACET_COUNT;
 
-		size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
 		size_t index_element_count = RP_GET_INDEX_ELEMENT_COUNT(facet_count);
-		float *vertices = calloc(vertex_element_count, sizeof(float));
-		uint16_t *indices = calloc(index_element_count, sizeof(uint16_t));
+		size_t index_bytes = index_element_count * sizeof(uint16_t);
+		uint16_t *indices = rp_arena_alloc(&scratch_arena, index_bytes, RP_PLAN_ALIGNMENT);
+		assert(indices);
 
-		rp_gen(&(struct rp_data){
-			.vertices = vertices,
+		rp_gen_indices(&(struct rp_data){
 			.indices = indices,
-			.facet_count = facet_count,
-			.facet_radius = 2.0f,
-			.extrusion_depth = g_depth
-		});
-
-		if (vbufs[i].id != SG_INVALID_ID) {
-			sg_destroy_buffer(vbufs[i]);
-		}
-		vbufs[i] = sg_make_buffer(&(sg_buffer_desc){
-			.size = vertex_element_count * sizeof(float),
-			.content = vertices,
-			.label = "rp-vertices"
+			.facet_count = facet_count
 		});
 
-		if (ibufs[i].id != SG_INVALID_ID) {
-			sg_destroy_buffer(ibufs[i]);
-		}
 		ibufs[i] = sg_make_buffer(&(sg_buffer_desc){
 			.type = SG_BUFFERTYPE_INDEXBUFFER,
 			.size = index_element_count * sizeof(uint16_t),
@@ -61,12 +81,52 @@ static void gen_polygon_buffers(void) {
 			.label = "rp-indices"
 		});
 
-		free(vertices);
-		free(indices);
+		rp_arena_reset(&scratch_arena);
+	}
+	return;
+}
+
+/* created once without content and refreshed in place, a palette change never recreates a buffer */
+static void make_vertex_buffers(void) {
+	for (int32_t i = 0; i < MESH_COUNT; ++i) {
+		vbufs[i] = sg_make_buffer(&(sg_buffer_desc){
+			.size = (int)rp_vertex_buffer_size(i + MIN_FACET_COUNT, &unit_prism_layout),
+			.usage = SG_USAGE_DYNAMIC,
+			.label = "rp-vertices"
+		});
+		mesh_palettes[i] = -1;
 	}
 	return;
 }
 
+/*
+	regenerates the displayed mesh if it holds another palette. only the displayed one is refreshed eagerly,
+	the others catch up when they are selected; called once per frame as a dynamic buffer takes one update per frame.
+*/
+static void refresh_vertex_buffer(void) {
+	const int32_t i = g_facet_count - MIN_FACET_COUNT;
+	if (mesh_palettes[i] == g_palette) return;
+
+	size_t vertex_bytes = rp_vertex_buffer_size(g_facet_count, &unit_prism_layout);
+	float *vertices = rp_arena_alloc(&scratch_arena, vertex_bytes, RP_PLAN_ALIGNMENT);
+	assert(vertices);
+
+	rp_gen_vertices(&(struct rp_data){
+		.vertices = vertices,
+		.facet_count = g_facet_count,
+		.facet_radius = 1.0f,
+		.extrusion_depth = 1.0f,
+		.layout = &unit_prism_layout,
+		.ring_colors = palettes[g_palette],
+		.table_cache = table_cache
+	});
+	sg_update_buffer(vbufs[i], vertices, (int)vertex_bytes);
+
+	rp_arena_reset(&scratch_arena);
+	mesh_palettes[i] = g_palette;
+	return;
+}
+
 static void bind_buffers_to_pipeline(void) {
 	bindings = (sg_bindings) {
 		.vertex_buffers[0] = vbufs[g_facet_count - MIN_FACET_COUNT],
@@ -100,8 +160,6 @@ EMSCRIPTEN_KEEPALIVE
 int32_t increase_depth(void) {
 	g_depth += DEPTH_INC;
 	if (g_depth > MAX_DEPTH) g_depth = MAX_DEPTH;
-	gen_polygon_buffers();
-	bind_buffers_to_pipeline();
 	return g_facet_count;
 }
 
@@ -111,11 +169,17 @@ EMSCRIPTEN_KEEPALIVE
 int32_t decrease_depth(void) {
 	g_depth -= DEPTH_INC;
 	if (g_depth < MIN_DEPTH) g_depth = MIN_DEPTH;
-	gen_polygon_buffers();
-	bind_buffers_to_pipeline();
 	return g_facet_count;
 }
 
+#ifdef EMSCRIPTEN
+EMSCRIPTEN_KEEPALIVE
+#endif
+int32_t next_palette(void) {
+	g_palette = (g_palette + 1) % PALETTE_COUNT;
+	return g_palette;
+}
+
 static void init(void) {
 	sg_setup(&(sg_desc){
 		.gl_force_gles2 = sapp_gles2(),
@@ -125,7 +189,13 @@ static void init(void) {
 	});
 
 	/* generate polygon buffers */
-	gen_polygon_buffers();
+	rp_fixed_pool_init(&table_pool, table_memory, sizeof(table_memory), TABLE_BLOCK_SIZE);
+	rp_arena_init(&scratch_arena, scratch_memory, sizeof(scratch_memory));
+	const struct rp_allocator table_allocator = rp_fixed_pool_allocator(&table_pool);
+	table_cache = rp_table_cache_create(&(struct rp_table_cache_desc){ .allocator = &table_allocator });
+	assert(table_cache);
+	gen_index_buffers();
+	make_vertex_buffers();
 
 	/* create shader */
 	sg_shader shd = sg_make_shader(demo_shader_desc());
@@ -133,10 +203,11 @@ static void init(void) {
 	/* create pipeline object */
 	pip = sg_make_pipeline(&(sg_pipeline_desc){
 		.layout = {
-			.buffers[0].stride = 28,
+			.buffers[0].stride = VERTEX_STRIDE,
 			.attrs = {
-				[ATTR_vs_position].format = SG_VERTEXFORMAT_FLOAT3,
-				[ATTR_vs_color0].format   = SG_VERTEXFORMAT_FLOAT4
+				[ATTR_vs_position] = { .offset = 0, .format = SG_VERTEXFORMAT_FLOAT3 },
+				[ATTR_vs_color0]   = { .offset = 12, .format = SG_VERTEXFORMAT_FLOAT4 },
+				[ATTR_vs_back]     = { .offset = 28, .format = SG_VERTEXFORMAT_FLOAT }
 			}
 		},
 		.shader = shd,
@@ -160,6 +231,12 @@ static void event(const sapp_event* e) {
 			increase_facets();
 		} else if (e->key_code == SAPP_KEYCODE_LEFT) {
 			decrease_facets();
+		} else if (e->key_code == SAPP_KEYCODE_UP) {
+			increase_depth();
+		} else if (e->key_code == SAPP_KEYCODE_DOWN) {
+			decrease_depth();
+		} else if (e->key_code == SAPP_KEYCODE_SPACE) {
+			next_palette();
 		}
 	}
 }
@@ -189,6 +266,11 @@ static void frame(void) {
 	);
 	struct mat4 model = mat4_translate(rotated_and_scaled, v3(0.0f, 0.0f, 0.0f));
 	vs_params.mvp = mat4_multiply(view_proj, model);
+	vs_params.radius = g_radius;
+	vs_params.depth = g_depth;
+
+	/* before the pass: the first frame after a palette change or a selection uploads the displayed mesh */
+	refresh_vertex_buffer();
 
 	sg_pass_action pass_action = {
 		.colors[0] = {
@@ -206,6 +288,7 @@ static void frame(void) {
 }
 
 void cleanup(void) {
+	rp_table_cache_destroy(table_cache);
 	sg_shutdown();
 }
 
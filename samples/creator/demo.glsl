@@ -3,15 +3,18 @@
 @vs vs
 uniform vs_params {
     mat4 mvp;
+    float radius;
+    float depth;
 };
 
 in vec4 position;
 in vec4 color0;
+in float back;
 
 out vec4 color;
 
 void main() {
-    gl_Position = mvp * position;
+    gl_Position = mvp * vec4(position.xy * radius, -back * depth, 1.0);
     color = color0;
 }
 @end
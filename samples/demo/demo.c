@@ -14,26 +14,23 @@
 
 static sg_pipeline pip;
 static sg_bindings bindings;
-static sg_buffer vbufs[MESH_COUNT];
-static sg_buffer ibufs[MESH_COUNT];
+/* every facet count lives in one vertex and one index buffer, bound once; a mesh is a range of the index buffer */
+static sg_buffer vbuf;
+static sg_buffer ibuf;
+static struct rp_mesh_range ranges[MESH_COUNT];
+
+/* generation scratch: the batch lives here until it is uploaded */
+static _Alignas(64) uint8_t scratch_memory[64 * 1024];
 
 static float rx, ry;
 static int32_t g_facet_count = MIN_FACET_COUNT;
 
-static void bind_buffers_to_pipeline(void) {
-	bindings = (sg_bindings) {
-		.vertex_buffers[0] = vbufs[g_facet_count - MIN_FACET_COUNT],
-		.index_buffer = ibufs[g_facet_count - MIN_FACET_COUNT]
-	};
-}
-
 #ifdef EMSCRIPTEN
 EMSCRIPTEN_KEEPALIVE
 #endif
 int32_t increase_facets(void) {
 	++g_facet_count;
 	if (g_facet_count >= MAX_FACET_COUNT) g_facet_count = MAX_FACET_COUNT - 1;
-	bind_buffers_to_pipeline();
 	return g_facet_count;
 }
 
@@ -43,40 +40,48 @@ EMSCRIPTEN_KEEPALIVE
 int32_t decrease_facets(void) {
 	--g_facet_count;
 	if (g_facet_count < MIN_FACET_COUNT) g_facet_count = MIN_FACET_COUNT;
-	bind_buffers_to_pipeline();
 	return g_facet_count;
 }
 
 static void gen_polygon_buffers(void) {
+	struct rp_data_desc descs[MESH_COUNT];
 	for (int32_t i = 0; i < MESH_COUNT; ++i) {
-		int32_t facet_count = i + MIN_FACET_COUNT;
-
-		size_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
-		size_t index_element_count = RP_GET_INDEX_ELEMENT_COUNT(facet_count);
-		float *vertices = calloc(vertex_element_count, sizeof(float));
-		uint16_t *indices = calloc(index_element_count, sizeof(uint16_t));
-
-		rp_gen(&(struct rp_data){
-			.vertices = vertices,
-			.indices = indices,
-			.facet_count = facet_count,
+		descs[i] = (struct rp_data_desc){
+			.facet_count = i + MIN_FACET_COUNT,
 			.facet_radius = 2.0f,
 			.extrusion_depth = 0.3f
-		});
-
-		vbufs[i] = sg_make_buffer(&(sg_buffer_desc){
-			.size = vertex_element_count * sizeof(float),
-			.content = vertices,
-			.label = "rp-vertices"
-		});
-
-		ibufs[i] = sg_make_buffer(&(sg_buffer_desc){
-			.type = SG_BUFFERTYPE_INDEXBUFFER,
-			.size = index_element_count * sizeof(uint16_t),
-			.content = indices,
-			.label = "rp-indices"
-		});
+		};
 	}
+
+	/* all meshes go into one vertex block and one index block, 4 * 250 + 2 * 20 vertices fit 16 bit indices */
+	size_t vertex_element_count, index_element_count;
+	rp_batch_size(descs, MESH_COUNT, &vertex_element_count, &index_element_count);
+	struct rp_arena scratch;
+	rp_arena_init(&scratch, scratch_memory, sizeof(scratch_memory));
+	float *vertices = rp_arena_alloc(&scratch, vertex_element_count * sizeof(float), RP_PLAN_ALIGNMENT);
+	uint16_t *indices = rp_arena_alloc(&scratch, index_element_count * sizeof(uint16_t), RP_PLAN_ALIGNMENT);
+	assert(vertices && indices);
+
+	rp_gen_batch(descs, MESH_COUNT, &(struct rp_batch){
+		.vertices = vertices,
+		.indices = indices,
+		.ranges = ranges,
+		/* gles2 has no base vertex, so it is baked into the indices */
+		.absolute_indices = true
+	});
+
+	vbuf = sg_make_buffer(&(sg_buffer_desc){
+		.size = (int)(vertex_element_count * sizeof(float)),
+		.content = vertices,
+		.label = "rp-vertices"
+	});
+
+	ibuf = sg_make_buffer(&(sg_buffer_desc){
+		.type = SG_BUFFERTYPE_INDEXBUFFER,
+		.size = (int)(index_element_count * sizeof(uint16_t)),
+		.content = indices,
+		.label = "rp-indices"
+	});
 	return;
 }
 
@@ -114,7 +119,10 @@ static void init(void) {
 		.label = "rp-pipeline"
 	});
 
-	bind_buffers_to_pipeline();
+	bindings = (sg_bindings){
+		.vertex_buffers[0] = vbuf,
+		.index_buffer = ibuf
+	};
 }
 
 static void event(const sapp_event* e) {
@@ -164,7 +172,8 @@ static void frame(void) {
 	sg_apply_pipeline(pip);
 	sg_apply_bindings(&bindings);
 	sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &vs_params, sizeof(vs_params));
-	sg_draw(0, RP_GET_INDEX_ELEMENT_COUNT(g_facet_count), 1);
+	const struct rp_mesh_range *range = &ranges[g_facet_count - MIN_FACET_COUNT];
+	sg_draw((int)range->first_index, (int)range->index_count, 1);
 	sg_end_pass();
 	sg_commit();
 }
@@ -3,5 +3,6 @@
 set -eu
 
 gcc write_gltf.c ../../rp_gen.c \
+	-lm -pthread \
 	-o gltfwriter
 
@@ -17,57 +17,57 @@ struct write_data {
 
 int main(void) {
 	const int32_t facet_count = 5;
-	const int32_t vertex_element_count = RP_GET_VERTEX_ELEMENT_COUNT(facet_count);
-	const int32_t index_element_count = RP_GET_INDEX_ELEMENT_COUNT(facet_count);
-
-    const size_t buffer_size = vertex_element_count * (int32_t)sizeof(float) + index_element_count * (int32_t)sizeof(uint16_t);
+	const struct rp_plan plan = rp_plan(&(struct rp_plan_desc){
+		.facet_count = facet_count
+	});
+	const size_t vertex_offset = plan.offsets[RP_STREAM_VERTICES];
+	const size_t vertex_buffer_size = plan.sizes[RP_STREAM_VERTICES];
+	const size_t index_offset = plan.offsets[RP_STREAM_INDICES];
+	const size_t index_buffer_size = plan.sizes[RP_STREAM_INDICES];
 
 	printf("facet count %d\n", facet_count);
-	printf("vertex element count %d\n", vertex_element_count);
-	printf("index element count %d\n", index_element_count);
-	printf("vertex buffer size %d\n", vertex_element_count * (int32_t)sizeof(float));
-	printf("index buffer size %d\n", index_element_count * (int32_t)sizeof(uint16_t));
-	printf("total buffer size %d\n", (int32_t)buffer_size);
-
-    void *buffer = calloc(buffer_size, 1);
-    uint16_t *indices = (uint16_t *)buffer;
-    float *vertices = (float *)(buffer + (index_element_count * sizeof(uint16_t)));
-
-    rp_gen(&(struct rp_data){
-        .vertices = vertices,
-        .indices = indices,
-        .facet_count = facet_count,
-        .facet_radius = 2.0f,
-        .extrusion_depth = 0.3f
-    });
-
-    FILE *bin_file = fopen("./out.bin", "wb");
-    fwrite(buffer, buffer_size, 1, bin_file);
-    fclose(bin_file);
+	printf("vertex count %u\n", plan.vertex_count);
+	printf("index count %zu\n", plan.index_count);
+	printf("vertex buffer size %zu\n", vertex_buffer_size);
+	printf("index buffer size %zu\n", index_buffer_size);
+	printf("total buffer size %zu\n", plan.total_bytes);
 
-	struct write_data wd = {0};
+	void *buffer = aligned_alloc(plan.alignment, plan.total_bytes);
+	memset(buffer, 0, plan.total_bytes);
+
+	struct rp_data rp = {
+		.facet_count = facet_count,
+		.facet_radius = 2.0f,
+		.extrusion_depth = 0.3f
+	};
+	rp_plan_bind(&plan, buffer, &rp, NULL);
+	rp_gen(&rp);
 
-	size_t index_buffer_size = index_element_count * sizeof(uint16_t);
-	size_t vertex_buffer_size = vertex_element_count * sizeof(float);
+	FILE *bin_file = fopen("./out.bin", "wb");
+	fwrite(buffer, plan.total_bytes, 1, bin_file);
+	fclose(bin_file);
+	free(buffer);
+
+	struct write_data wd = {0};
 
 	wd.buffers[0] = (cgltf_buffer){
-		.size =  index_buffer_size + vertex_buffer_size,
+		.size = plan.total_bytes,
 		.uri = "out.bin"
 	};
 
 	// index buffer view
 	wd.buffer_views[0] = (cgltf_buffer_view){
 		.buffer = &wd.buffers[0],
-		.offset = 0,
-		.size = 72,
+		.offset = index_offset,
+		.size = index_buffer_size,
 		.type = cgltf_buffer_view_type_indices
 	};
 
 	// position buffer view
 	wd.buffer_views[1] = (cgltf_buffer_view){
 		.buffer = &wd.buffers[0],
-		.offset = index_buffer_size,
-		.size = 392,
+		.offset = vertex_offset,
+		.size = vertex_buffer_size,
 		.stride = 28,
 		.type = cgltf_buffer_view_type_vertices
 	};
@@ -75,8 +75,8 @@ int main(void) {
 	// color buffer view
 	wd.buffer_views[2] = (cgltf_buffer_view){
 		.buffer = &wd.buffers[0],
-		.offset =  index_buffer_size + 12,
-		.size = 392 - 12,
+		.offset = vertex_offset + 12,
+		.size = vertex_buffer_size - 12,
 		.stride = 28,
 		.type = cgltf_buffer_view_type_vertices
 	};
@@ -86,7 +86,7 @@ int main(void) {
 		.component_type = cgltf_component_type_r_16u,
 		.type = cgltf_type_scalar,
 		.offset = 0,
-		.count = 36,
+		.count = plan.index_count,
 		.buffer_view = &wd.buffer_views[0]
 	};
 
@@ -95,7 +95,7 @@ int main(void) {
 		.component_type = cgltf_component_type_r_32f,
 		.type = cgltf_type_vec3,
 		.offset = 0,
-		.count = 14,
+		.count = plan.vertex_count,
 		.buffer_view = &wd.buffer_views[1]
 	};
 
@@ -104,7 +104,7 @@ int main(void) {
 		.component_type = cgltf_component_type_r_32f,
 		.type = cgltf_type_vec4,
 		.offset = 0,
-		.count = 14,
+		.count = plan.vertex_count,
 		.buffer_view = &wd.buffer_views[2]
 	};
 
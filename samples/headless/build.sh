@@ -0,0 +1,28 @@
+#!/bin/sh
+
+# builds the samples against sokol_gfx's dummy backend into ./dist, no gpu or window needed.
+# each sample is copied into a scratch tree where sokol_app.h is replaced by headless_app.h;
+# allocations are counted with GNU ld's --wrap, so this needs gcc/clang with a GNU linker.
+
+set -eu
+
+mkdir -p ./dist
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+cp ../../rp_gen.h "$scratch"/
+
+for sample in demo creator stress; do
+	dir="$scratch/samples/$sample"
+	mkdir -p "$dir"
+	cp ../$sample/*.c ../$sample/*.h "$dir"/
+	mv "$dir/sokol_app.h" "$dir/sokol_app_real.h"
+	mv "$dir/sokol_gfx.h" "$dir/sokol_gfx_real.h"
+	cp headless_app.h "$dir/sokol_app.h"
+	echo "/* included by sokol_app.h */" > "$dir/sokol_gfx.h"
+
+	gcc -O2 -std=gnu11 "$dir/$sample.c" "$dir/watt_math.c" headless.c ../../rp_gen.c \
+		-I"$dir" \
+		-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=aligned_alloc,--wrap=free \
+		-lm -pthread \
+		-o ./dist/$sample
+done
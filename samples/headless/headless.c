@@ -0,0 +1,304 @@
+/*
+	headless frame benchmark: runs a sample's init/frame/event/cleanup callbacks on sokol_gfx's
+	dummy backend, replays a scripted key sequence and reports the cpu time of every frame,
+	the allocations made and the bytes handed to sokol_gfx for upload.
+
+	usage: <sample> [script] [frame count]
+
+	a script line is "<frame> <key> [repeat] [interval]": a key press (down and up) of
+	left/right/up/down/space before <frame>'s frame callback, pressed <repeat> times every
+	<interval> frames. '#' starts a comment.
+
+	allocations are counted by wrapping the allocator at link time (see build.sh), so they
+	include sokol_gfx, the rp_gen library and the sample, but not libc internals.
+*/
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sokol_app_real.h"
+#include "sokol_gfx_real.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define DEFAULT_FRAME_COUNT 600
+#define MAX_EVENTS 4096
+
+/* what one phase (init or the frames) cost */
+struct phase_stats {
+	uint64_t allocations;
+	uint64_t allocated_bytes;
+	uint64_t frees;
+	uint64_t uploaded_bytes;
+	uint64_t uploads;
+};
+
+struct scripted_key {
+	int32_t frame;
+	int32_t order; /* keys of one frame are sent in script order */
+	sapp_keycode key;
+};
+
+static struct phase_stats init_stats;
+static struct phase_stats frame_stats;
+/* NULL outside of the sample's callbacks, the harness' own allocations are not counted */
+static struct phase_stats *phase;
+
+static struct scripted_key events[MAX_EVENTS];
+static int32_t event_count;
+
+static double now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+/* allocation counting, build.sh links with --wrap for each of these */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_aligned_alloc(size_t alignment, size_t size);
+void __real_free(void *ptr);
+
+static void count_allocation(size_t size) {
+	if (!phase) return;
+	++phase->allocations;
+	phase->allocated_bytes += size;
+}
+
+void *__wrap_malloc(size_t size) {
+	count_allocation(size);
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+	count_allocation(count * size);
+	return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+	count_allocation(size);
+	return __real_realloc(ptr, size);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size) {
+	count_allocation(size);
+	return __real_aligned_alloc(alignment, size);
+}
+
+void __wrap_free(void *ptr) {
+	if (phase && ptr) ++phase->frees;
+	__real_free(ptr);
+}
+
+/* upload counting through sokol_gfx's trace hooks: the bytes a real backend would copy to the gpu */
+static void count_upload(int size) {
+	if (!phase || size <= 0) return;
+	++phase->uploads;
+	phase->uploaded_bytes += (uint64_t)size;
+}
+
+static int image_content_size(const sg_image_content *content) {
+	int size = 0;
+	for (int face = 0; face < SG_CUBEFACE_NUM; ++face) {
+		for (int mip = 0; mip < SG_MAX_MIPMAPS; ++mip) {
+			size += content->subimage[face][mip].size;
+		}
+	}
+	return size;
+}
+
+static void trace_make_buffer(const sg_buffer_desc *desc, sg_buffer result, void *user_data) {
+	(void)result; (void)user_data;
+	if (desc->content) count_upload(desc->size);
+}
+
+static void trace_make_image(const sg_image_desc *desc, sg_image result, void *user_data) {
+	(void)result; (void)user_data;
+	count_upload(image_content_size(&desc->content));
+}
+
+static void trace_update_buffer(sg_buffer buf, const void *data_ptr, int data_size, void *user_data) {
+	(void)buf; (void)data_ptr; (void)user_data;
+	count_upload(data_size);
+}
+
+static void trace_update_image(sg_image img, const sg_image_content *data, void *user_data) {
+	(void)img; (void)user_data;
+	count_upload(image_content_size(data));
+}
+
+static void trace_append_buffer(sg_buffer buf, const void *data_ptr, int data_size, int result, void *user_data) {
+	(void)buf; (void)data_ptr; (void)result; (void)user_data;
+	count_upload(data_size);
+}
+
+void headless_gfx_ready(void) {
+	sg_install_trace_hooks(&(sg_trace_hooks){
+		.make_buffer = trace_make_buffer,
+		.make_image = trace_make_image,
+		.update_buffer = trace_update_buffer,
+		.update_image = trace_update_image,
+		.append_buffer = trace_append_buffer
+	});
+}
+
+/* the sokol_app functions the samples call */
+int sapp_width(void) { return WIDTH; }
+int sapp_height(void) { return HEIGHT; }
+bool sapp_gles2(void) { return false; }
+const void *sapp_metal_get_device(void) { return NULL; }
+const void *sapp_metal_get_renderpass_descriptor(void) { return NULL; }
+const void *sapp_metal_get_drawable(void) { return NULL; }
+
+static bool parse_key(const char *name, sapp_keycode *key) {
+	static const struct { const char *name; sapp_keycode key; } keys[] = {
+		{ "left", SAPP_KEYCODE_LEFT },
+		{ "right", SAPP_KEYCODE_RIGHT },
+		{ "up", SAPP_KEYCODE_UP },
+		{ "down", SAPP_KEYCODE_DOWN },
+		{ "space", SAPP_KEYCODE_SPACE }
+	};
+	for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+		if (!strcmp(name, keys[i].name)) {
+			*key = keys[i].key;
+			return true;
+		}
+	}
+	return false;
+}
+
+static int compare_events(const void *a, const void *b) {
+	const struct scripted_key *ea = a;
+	const struct scripted_key *eb = b;
+	if (ea->frame != eb->frame) return (ea->frame > eb->frame) - (ea->frame < eb->frame);
+	return (ea->order > eb->order) - (ea->order < eb->order);
+}
+
+static bool load_script(const char *path) {
+	FILE *file = fopen(path, "r");
+	if (!file) {
+		fprintf(stderr, "can't open script %s\n", path);
+		return false;
+	}
+
+	char line[256];
+	int32_t line_number = 0;
+	while (fgets(line, sizeof(line), file)) {
+		++line_number;
+		char *comment = strchr(line, '#');
+		if (comment) *comment = '\0';
+
+		int32_t frame, repeat = 1, interval = 1;
+		char name[32];
+		const int fields = sscanf(line, "%d %31s %d %d", &frame, name, &repeat, &interval);
+		if (fields <= 0) continue;
+		sapp_keycode key;
+		if (fields < 2 || !parse_key(name, &key) || frame < 0 || repeat < 1 || interval < 1) {
+			fprintf(stderr, "%s:%d: expected <frame> <left|right|up|down|space> [repeat] [interval]\n", path,
+				line_number);
+			fclose(file);
+			return false;
+		}
+		for (int32_t i = 0; i < repeat && event_count < MAX_EVENTS; ++i) {
+			events[event_count] = (struct scripted_key){ .frame = frame + i * interval, .order = event_count, .key = key };
+			++event_count;
+		}
+	}
+	fclose(file);
+
+	qsort(events, (size_t)event_count, sizeof(events[0]), compare_events);
+	return true;
+}
+
+static void send_key(const sapp_desc *desc, sapp_event_type type, sapp_keycode key, uint32_t frame) {
+	desc->event_cb(&(sapp_event){
+		.frame_count = frame,
+		.type = type,
+		.key_code = key,
+		.window_width = WIDTH,
+		.window_height = HEIGHT,
+		.framebuffer_width = WIDTH,
+		.framebuffer_height = HEIGHT
+	});
+}
+
+static int compare_doubles(const void *a, const void *b) {
+	const double da = *(const double *)a;
+	const double db = *(const double *)b;
+	return (da > db) - (da < db);
+}
+
+/* nearest rank of a sorted sample */
+static double percentile(const double *sorted, int32_t count, double p) {
+	int32_t rank = (int32_t)(p / 100.0 * count + 0.5);
+	if (rank < 1) rank = 1;
+	if (rank > count) rank = count;
+	return sorted[rank - 1];
+}
+
+static void print_phase(const char *name, const struct phase_stats *stats, int32_t frame_count) {
+	printf("%-8s %10llu allocations %12llu bytes %10llu frees %8llu uploads %12llu bytes uploaded\n", name,
+		(unsigned long long)stats->allocations, (unsigned long long)stats->allocated_bytes,
+		(unsigned long long)stats->frees, (unsigned long long)stats->uploads,
+		(unsigned long long)stats->uploaded_bytes);
+	if (frame_count > 0) {
+		printf("%-8s %10.2f allocations %12.1f bytes %10.2f frees %8.2f uploads %12.1f bytes uploaded\n",
+			"/frame", (double)stats->allocations / frame_count, (double)stats->allocated_bytes / frame_count,
+			(double)stats->frees / frame_count, (double)stats->uploads / frame_count,
+			(double)stats->uploaded_bytes / frame_count);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	const char *script = argc > 1 ? argv[1] : NULL;
+	const int32_t frame_count = argc > 2 ? atoi(argv[2]) : DEFAULT_FRAME_COUNT;
+	if (frame_count < 1 || (script && !load_script(script))) {
+		fprintf(stderr, "usage: %s [script] [frame count]\n", argv[0]);
+		return 1;
+	}
+
+	const sapp_desc desc = sokol_main(argc, argv);
+	assert(desc.init_cb && desc.frame_cb);
+	double *frame_ms = malloc((size_t)frame_count * sizeof(double));
+	assert(frame_ms);
+
+	phase = &init_stats;
+	double start = now_ms();
+	desc.init_cb();
+	const double init_ms = now_ms() - start;
+
+	int32_t next_event = 0;
+	phase = &frame_stats;
+	for (int32_t frame = 0; frame < frame_count; ++frame) {
+		start = now_ms();
+		/* the input handling is part of the frame, that is where parameter changes regenerate */
+		for (; next_event < event_count && events[next_event].frame <= frame; ++next_event) {
+			if (!desc.event_cb) continue;
+			send_key(&desc, SAPP_EVENTTYPE_KEY_DOWN, events[next_event].key, (uint32_t)frame);
+			send_key(&desc, SAPP_EVENTTYPE_KEY_UP, events[next_event].key, (uint32_t)frame);
+		}
+		desc.frame_cb();
+		frame_ms[frame] = now_ms() - start;
+	}
+
+	phase = NULL;
+	if (desc.cleanup_cb) desc.cleanup_cb();
+
+	qsort(frame_ms, (size_t)frame_count, sizeof(double), compare_doubles);
+	double total_ms = 0.0;
+	for (int32_t frame = 0; frame < frame_count; ++frame) total_ms += frame_ms[frame];
+
+	printf("%s: %d frames, %d scripted keys from %s\n", argv[0], frame_count, next_event, script ? script : "no script");
+	printf("init     %10.3f ms\n", init_ms);
+	printf("frame    mean %.4f ms, p50 %.4f ms, p90 %.4f ms, p99 %.4f ms, max %.4f ms\n", total_ms / frame_count,
+		percentile(frame_ms, frame_count, 50.0), percentile(frame_ms, frame_count, 90.0),
+		percentile(frame_ms, frame_count, 99.0), frame_ms[frame_count - 1]);
+	print_phase("init", &init_stats, 0);
+	print_phase("frames", &frame_stats, frame_count);
+
+	free(frame_ms);
+	return 0;
+}
@@ -0,0 +1,20 @@
+/*
+	stands in for sokol_app.h when build.sh compiles a sample headless: the sample keeps its
+	sokol_app.h / sokol_gfx.h includes, but gets the sokol_app declarations only and sokol_gfx's
+	dummy backend with trace hooks, which headless.c installs to count uploaded bytes.
+*/
+#undef SOKOL_IMPL
+#include "sokol_app_real.h"
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#define SOKOL_TRACE_HOOKS
+#include "sokol_gfx_real.h"
+
+/* sg_setup clears the trace hooks, so they go in right after it */
+void headless_gfx_ready(void);
+/* variadic, the sample passes a compound literal with commas in it */
+#define sg_setup(...) (sg_setup(__VA_ARGS__), headless_gfx_ready())
+
+/* the generated shader headers only carry gles2 and metal sources, the dummy backend accepts either */
+#define SOKOL_GLES2
+#define sg_query_backend() SG_BACKEND_GLES2
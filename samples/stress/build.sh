@@ -0,0 +1,23 @@
+#!/bin/sh
+
+set -eu
+
+./sokol-shdc --input stress.glsl --output stress.glsl.h --slang metal_macos:glsl100
+
+mkdir -p ./dist
+
+gcc stress.c watt_math.c ../../rp_gen.c \
+	-DSOKOL_METAL=1 \
+	-o ./dist/stress \
+	-ObjC \
+	-fobjc-arc \
+	-framework Cocoa \
+	-framework QuartzCore \
+	-framework Metal \
+	-framework MetalKit \
+	-framework AudioToolbox
+
+emcc stress.c watt_math.c ../../rp_gen.c \
+	-DSOKOL_GLES2=1 \
+	-o ./dist/stress.js
+
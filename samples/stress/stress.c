@@ -0,0 +1,303 @@
+#define SOKOL_IMPL
+#include "sokol_app.h"
+#include "sokol_gfx.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../../rp_gen.h"
+#include "watt_math.h"
+#include "stress.glsl.h"
+
+#define MIN_FACET_COUNT 3
+#define MAX_FACET_COUNT 23
+#define MESH_COUNT (MAX_FACET_COUNT - MIN_FACET_COUNT)
+
+#ifndef INSTANCE_COUNT
+#define INSTANCE_COUNT 100000
+#endif
+/* prisms are scattered over a cube of this edge length around the origin */
+#define FIELD_SIZE 120.0f
+
+#define SAMPLE_COUNT 4
+
+/* per-instance vertex data, matches the inst_* attributes of stress.glsl */
+struct instance {
+	float position[3];
+	float scale;
+	struct quat rotation;
+	float color[4];
+};
+
+/* what the cpu animates the rotation from */
+struct spin {
+	struct vec3 axis;
+	float speed;
+};
+
+static sg_pipeline pip;
+static sg_bindings bindings;
+/* every facet count lives in one vertex and one index buffer, a bucket draws one mesh range */
+static sg_buffer vbuf;
+static sg_buffer ibuf;
+static sg_buffer instance_buf;
+static struct rp_mesh_range ranges[MESH_COUNT];
+
+/* instances are sorted by facet count, bucket i owns [bucket_first[i], bucket_first[i + 1]) */
+static struct instance instances[INSTANCE_COUNT];
+static struct spin spins[INSTANCE_COUNT];
+static int32_t bucket_first[MESH_COUNT + 1];
+
+/* generation scratch: the batch lives here until it is uploaded */
+static _Alignas(64) uint8_t scratch_memory[64 * 1024];
+
+static float time_s;
+
+/* cpu frame time statistics, printed and reset once per second */
+struct frame_stats {
+	double update_ms;
+	double frame_ms;
+	double max_frame_ms;
+	double since_ms;
+	int32_t frames;
+};
+static struct frame_stats stats;
+
+static uint32_t rng_state = 0x9e3779b9u;
+
+/* xorshift32 */
+static uint32_t random_u32(void) {
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static float random_float(float lo, float hi) {
+	return lo + (hi - lo) * (float)(random_u32() >> 8) / (float)(1u << 24);
+}
+
+static double now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static void gen_polygon_buffers(void) {
+	struct rp_data_desc descs[MESH_COUNT];
+	for (int32_t i = 0; i < MESH_COUNT; ++i) {
+		descs[i] = (struct rp_data_desc){
+			.facet_count = i + MIN_FACET_COUNT,
+			.facet_radius = 0.5f,
+			.extrusion_depth = 0.5f
+		};
+	}
+
+	size_t vertex_element_count, index_element_count;
+	rp_batch_size(descs, MESH_COUNT, &vertex_element_count, &index_element_count);
+	struct rp_arena scratch;
+	rp_arena_init(&scratch, scratch_memory, sizeof(scratch_memory));
+	float *vertices = rp_arena_alloc(&scratch, vertex_element_count * sizeof(float), RP_PLAN_ALIGNMENT);
+	uint16_t *indices = rp_arena_alloc(&scratch, index_element_count * sizeof(uint16_t), RP_PLAN_ALIGNMENT);
+	assert(vertices && indices);
+
+	rp_gen_batch(descs, MESH_COUNT, &(struct rp_batch){
+		.vertices = vertices,
+		.indices = indices,
+		.ranges = ranges,
+		/* gles2 has no base vertex, so it is baked into the indices */
+		.absolute_indices = true
+	});
+
+	vbuf = sg_make_buffer(&(sg_buffer_desc){
+		.size = (int)(vertex_element_count * sizeof(float)),
+		.content = vertices,
+		.label = "rp-vertices"
+	});
+
+	ibuf = sg_make_buffer(&(sg_buffer_desc){
+		.type = SG_BUFFERTYPE_INDEXBUFFER,
+		.size = (int)(index_element_count * sizeof(uint16_t)),
+		.content = indices,
+		.label = "rp-indices"
+	});
+	return;
+}
+
+/* scatters the prisms and sorts them into facet count buckets with a counting pass */
+static void init_instances(void) {
+	static uint8_t mesh_of[INSTANCE_COUNT];
+	int32_t bucket_count[MESH_COUNT] = { 0 };
+	for (int32_t i = 0; i < INSTANCE_COUNT; ++i) {
+		mesh_of[i] = (uint8_t)(random_u32() % MESH_COUNT);
+		++bucket_count[mesh_of[i]];
+	}
+
+	int32_t next[MESH_COUNT];
+	bucket_first[0] = 0;
+	for (int32_t m = 0; m < MESH_COUNT; ++m) {
+		next[m] = bucket_first[m];
+		bucket_first[m + 1] = bucket_first[m] + bucket_count[m];
+	}
+
+	for (int32_t i = 0; i < INSTANCE_COUNT; ++i) {
+		const int32_t slot = next[mesh_of[i]]++;
+		struct instance *inst = &instances[slot];
+		inst->position[0] = random_float(-0.5f, 0.5f) * FIELD_SIZE;
+		inst->position[1] = random_float(-0.5f, 0.5f) * FIELD_SIZE;
+		inst->position[2] = random_float(-0.5f, 0.5f) * FIELD_SIZE;
+		inst->scale = random_float(0.5f, 1.5f);
+		inst->color[0] = random_float(0.3f, 1.0f);
+		inst->color[1] = random_float(0.3f, 1.0f);
+		inst->color[2] = random_float(0.3f, 1.0f);
+		inst->color[3] = 1.0f;
+
+		spins[slot].axis = vec3_normalize(v3(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), 1.0f));
+		spins[slot].speed = random_float(0.5f, 3.0f);
+	}
+	return;
+}
+
+/* the per-frame cpu work: a new rotation for every prism */
+static void update_instances(void) {
+	for (int32_t i = 0; i < INSTANCE_COUNT; ++i) {
+		instances[i].rotation = quat_axis_angle(spins[i].axis, time_s * spins[i].speed);
+	}
+	return;
+}
+
+static void init(void) {
+	sg_setup(&(sg_desc){
+		.gl_force_gles2 = sapp_gles2(),
+		.mtl_device = sapp_metal_get_device(),
+		.mtl_renderpass_descriptor_cb = sapp_metal_get_renderpass_descriptor,
+		.mtl_drawable_cb = sapp_metal_get_drawable
+	});
+	assert(sg_query_feature(SG_FEATURE_INSTANCING));
+
+	/* generate polygon buffers */
+	gen_polygon_buffers();
+	init_instances();
+
+	/* the instances are rewritten every frame, appended once and drawn bucket by bucket from offsets into it */
+	instance_buf = sg_make_buffer(&(sg_buffer_desc){
+		.size = (int)sizeof(instances),
+		.usage = SG_USAGE_STREAM,
+		.label = "rp-instances"
+	});
+
+	/* create shader */
+	sg_shader shd = sg_make_shader(stress_shader_desc());
+
+	/* create pipeline object */
+	pip = sg_make_pipeline(&(sg_pipeline_desc){
+		.layout = {
+			.buffers = {
+				[0].stride = 28,
+				[1] = { .stride = (int)sizeof(struct instance), .step_func = SG_VERTEXSTEP_PER_INSTANCE }
+			},
+			.attrs = {
+				[ATTR_vs_position] = { .format = SG_VERTEXFORMAT_FLOAT3 },
+				[ATTR_vs_color0] = { .offset = 12, .format = SG_VERTEXFORMAT_FLOAT4 },
+				[ATTR_vs_inst_pos_scale] = { .buffer_index = 1, .offset = 0, .format = SG_VERTEXFORMAT_FLOAT4 },
+				[ATTR_vs_inst_rotation] = { .buffer_index = 1, .offset = 16, .format = SG_VERTEXFORMAT_FLOAT4 },
+				[ATTR_vs_inst_color] = { .buffer_index = 1, .offset = 32, .format = SG_VERTEXFORMAT_FLOAT4 }
+			}
+		},
+		.shader = shd,
+		.index_type = SG_INDEXTYPE_UINT16,
+		.depth_stencil = {
+			.depth_compare_func = SG_COMPAREFUNC_LESS_EQUAL,
+			.depth_write_enabled = true,
+		},
+		.rasterizer.cull_mode = SG_CULLMODE_BACK,
+		.rasterizer.sample_count = SAMPLE_COUNT,
+		.label = "rp-stress-pipeline"
+	});
+
+	bindings = (sg_bindings){
+		.vertex_buffers = { [0] = vbuf, [1] = instance_buf },
+		.index_buffer = ibuf
+	};
+	stats.since_ms = now_ms();
+}
+
+static void event(const sapp_event* e) {
+	assert((e->type >= 0) && (e->type < _SAPP_EVENTTYPE_NUM));
+}
+
+static void report_frame_time(double frame_start, double update_ms) {
+	const double end = now_ms();
+	const double frame_ms = end - frame_start;
+	stats.update_ms += update_ms;
+	stats.frame_ms += frame_ms;
+	if (frame_ms > stats.max_frame_ms) stats.max_frame_ms = frame_ms;
+	++stats.frames;
+
+	if (end - stats.since_ms < 1000.0) return;
+	printf("stress: %d prisms in %d draws, cpu frame %.2f ms avg %.2f ms max, instance update %.2f ms\n",
+		INSTANCE_COUNT, MESH_COUNT, stats.frame_ms / stats.frames, stats.max_frame_ms, stats.update_ms / stats.frames);
+	stats = (struct frame_stats){ .since_ms = end };
+}
+
+static void frame(void) {
+	const double frame_start = now_ms();
+
+	/* NOTE: the vs_params_t struct has been code-generated by the shader-code-gen */
+	vs_params_t vs_params;
+	const float w = (float) sapp_width();
+	const float h = (float) sapp_height();
+	time_s += 1.0f / 60.0f;
+
+	/* orbit around the field */
+	const float orbit = time_s * 0.1f;
+	const struct vec3 eye = v3(sinf(orbit) * FIELD_SIZE, FIELD_SIZE * 0.25f, cosf(orbit) * FIELD_SIZE);
+	struct mat4 proj = mat4_perspective(60.0f / 180.0f * WATT_PI32, w/h, 0.1f, FIELD_SIZE * 3.0f);
+	struct mat4 view = mat4_look_at(eye, vec3_scale(eye, -1.0f), v3(0.0f, 1.0f, 0.0f));
+	vs_params.view_proj = mat4_multiply(proj, view);
+
+	const double update_start = now_ms();
+	update_instances();
+	const double update_ms = now_ms() - update_start;
+
+	sg_pass_action pass_action = {
+		.colors[0] = {
+			.action = SG_ACTION_CLEAR,
+			.val = { 0.25f, 0.5f, 0.75f, 1.0f }
+		}
+	};
+	sg_begin_default_pass(&pass_action, (int)w, (int)h);
+	sg_apply_pipeline(pip);
+	sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &vs_params, sizeof(vs_params));
+	const int instance_offset = sg_append_buffer(instance_buf, instances, (int)sizeof(instances));
+	for (int32_t m = 0; m < MESH_COUNT; ++m) {
+		const int32_t count = bucket_first[m + 1] - bucket_first[m];
+		if (count == 0) continue;
+		bindings.vertex_buffer_offsets[1] = instance_offset + bucket_first[m] * (int)sizeof(struct instance);
+		sg_apply_bindings(&bindings);
+		sg_draw((int)ranges[m].first_index, (int)ranges[m].index_count, count);
+	}
+	sg_end_pass();
+	sg_commit();
+
+	report_frame_time(frame_start, update_ms);
+}
+
+void cleanup(void) {
+	sg_shutdown();
+}
+
+sapp_desc sokol_main(int argc, char* argv[]) {
+	return (sapp_desc){
+		.init_cb = init,
+		.event_cb = event,
+		.frame_cb = frame,
+		.cleanup_cb = cleanup,
+		.width = 1280,
+		.height = 720,
+		.sample_count = SAMPLE_COUNT,
+		.gl_force_gles2 = true,
+		.window_title = "rp stress",
+	};
+}
@@ -0,0 +1,34 @@
+@ctype mat4 mat4
+
+@vs vs
+uniform vs_params {
+    mat4 view_proj;
+};
+
+in vec4 position;
+in vec4 color0;
+in vec4 inst_pos_scale;
+in vec4 inst_rotation;
+in vec4 inst_color;
+
+out vec4 color;
+
+void main() {
+    vec3 p = position.xyz * inst_pos_scale.w;
+    vec3 t = 2.0 * cross(inst_rotation.xyz, p);
+    p += inst_rotation.w * t + cross(inst_rotation.xyz, t);
+    gl_Position = view_proj * vec4(p + inst_pos_scale.xyz, 1.0);
+    color = color0 * inst_color;
+}
+@end
+
+@fs fs
+in vec4 color;
+out vec4 frag_color;
+
+void main() {
+    frag_color = color;
+}
+@end
+
+@program stress vs fs